@@ -0,0 +1,521 @@
+#ifndef BATCH_GCD_H
+#define BATCH_GCD_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cstddef>
+#include <vector>
+
+#include "GcdEngine.h"
+
+// Lane-parallel kernels need GCC-style target attributes and CPU detection
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #define FRACT_BATCH_GCD_X86 1
+    #include <immintrin.h>
+#endif
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // SIMD GCD KERNELS CLASS +++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Lane-parallel binary GCD over unsigned integers of [Bytes] bytes.
+     *  Each kernel takes odd operands [a] and [b], or a zero [a], and
+     *  leaves gcd( a, b ) in [b], working on as many whole vectors as fit
+     *  in [count]. It returns the number of elements done; the caller
+     *  finishes the rest. Types without kernels have none available.
+     */
+
+    template< std::size_t Bytes >
+    class SimdGcdKernels
+    {
+        public:
+
+        // KERNEL TYPE --------------------------------------------------------
+
+        template< class IntType >
+        using kernel_type = std::size_t ( * )( IntType *, IntType *,
+                                               std::size_t );
+
+        // SELECT -------------------------------------------------------------
+
+        template< class IntType >
+        static kernel_type< IntType > const select( char const * & name )
+        {
+            name = "scalar";
+            return nullptr;
+        }
+    };
+
+    #if defined( FRACT_BATCH_GCD_X86 )
+
+    // 64-BIT LANES -----------------------------------------------------------
+
+    template<>
+    class SimdGcdKernels< 8 >
+    {
+        public:
+
+        template< class IntType >
+        using kernel_type = std::size_t ( * )( IntType *, IntType *,
+                                               std::size_t );
+
+        // SELECT -------------------------------------------------------------
+
+        /*  Picks the widest kernel the running CPU supports.
+         */
+
+        template< class IntType >
+        static kernel_type< IntType > const select( char const * & name )
+        {
+            __builtin_cpu_init();
+
+            if( __builtin_cpu_supports( "avx512f" ) &&
+                __builtin_cpu_supports( "avx512cd" ) )
+            {
+                name = "avx-512";
+                return &avx512< IntType >;
+            }
+
+            if( __builtin_cpu_supports( "avx2" ) )
+            {
+                name = "avx2";
+                return &avx2< IntType >;
+            }
+
+            name = "scalar";
+            return nullptr;
+        }
+
+        // AVX2 ---------------------------------------------------------------
+
+        /*  AVX2 has no per-lane bit count, so each step removes a single
+         *  factor of two: an even [a] is halved, an odd one is replaced by
+         *  half its distance from [b], and [b] keeps the smaller odd value.
+         *  Unsigned order is found by flipping the sign bits.
+         */
+
+        template< class IntType >
+        __attribute__(( target( "avx2" ) ))
+        static std::size_t avx2( IntType * a, IntType * b,
+                                 std::size_t const count )
+        {
+            __m256i const one = _mm256_set1_epi64x( 1 );
+            __m256i const bias = _mm256_set1_epi64x( 1ll << 63 );
+
+            std::size_t i = 0;
+
+            for( ; i + 4 <= count; i += 4 )
+            {
+                __m256i x = _mm256_loadu_si256( ( __m256i const * )( a + i ) );
+                __m256i y = _mm256_loadu_si256( ( __m256i const * )( b + i ) );
+
+                while( !_mm256_testz_si256( x, x ) )
+                {
+                    __m256i const odd =
+                        _mm256_cmpeq_epi64( _mm256_and_si256( x, one ), one );
+                    __m256i const less =
+                        _mm256_cmpgt_epi64( _mm256_xor_si256( y, bias ),
+                                            _mm256_xor_si256( x, bias ) );
+                    __m256i const diff =
+                        _mm256_blendv_epi8( _mm256_sub_epi64( x, y ),
+                                            _mm256_sub_epi64( y, x ), less );
+
+                    y = _mm256_blendv_epi8( y, x,
+                                            _mm256_and_si256( odd, less ) );
+                    x = _mm256_srli_epi64
+                    (
+                        _mm256_blendv_epi8( x, diff, odd ), 1
+                    );
+                }
+
+                _mm256_storeu_si256( ( __m256i * )( b + i ), y );
+            }
+
+            return i;
+        }
+
+        // AVX-512 ------------------------------------------------------------
+
+        /*  With a per-lane leading zero count each step strips every factor
+         *  of two at once, as [BinaryGcd] does. Finished lanes are masked
+         *  off.
+         */
+
+        template< class IntType >
+        __attribute__(( target( "avx512f,avx512cd" ) ))
+        static std::size_t avx512( IntType * a, IntType * b,
+                                   std::size_t const count )
+        {
+            __m512i const zero = _mm512_setzero_si512();
+            __m512i const topIndex = _mm512_set1_epi64( 63 );
+
+            std::size_t i = 0;
+
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m512i x = _mm512_loadu_si512( a + i );
+                __m512i y = _mm512_loadu_si512( b + i );
+
+                __mmask8 active = _mm512_test_epi64_mask( x, x );
+
+                while( active != 0 )
+                {
+                    __m512i const high =
+                        _mm512_mask_max_epu64( x, active, x, y );
+
+                    y = _mm512_mask_min_epu64( y, active, x, y );
+
+                    __m512i const diff =
+                        _mm512_mask_sub_epi64( zero, active, high, y );
+
+                    // A zero difference gives an out of range shift, which
+                    // clears the lane
+
+                    __m512i const bit = _mm512_and_si512
+                    (
+                        diff, _mm512_sub_epi64( zero, diff )
+                    );
+                    __m512i const zeros = _mm512_sub_epi64
+                    (
+                        topIndex, _mm512_maskz_lzcnt_epi64( active, bit )
+                    );
+
+                    x = _mm512_mask_srlv_epi64( x, active, diff, zeros );
+
+                    active = _mm512_test_epi64_mask( x, x );
+                }
+
+                _mm512_storeu_si512( b + i, y );
+            }
+
+            return i;
+        }
+    };
+
+    // 32-BIT LANES -----------------------------------------------------------
+
+    template<>
+    class SimdGcdKernels< 4 >
+    {
+        public:
+
+        template< class IntType >
+        using kernel_type = std::size_t ( * )( IntType *, IntType *,
+                                               std::size_t );
+
+        // SELECT -------------------------------------------------------------
+
+        template< class IntType >
+        static kernel_type< IntType > const select( char const * & name )
+        {
+            __builtin_cpu_init();
+
+            if( __builtin_cpu_supports( "avx512f" ) &&
+                __builtin_cpu_supports( "avx512cd" ) )
+            {
+                name = "avx-512";
+                return &avx512< IntType >;
+            }
+
+            if( __builtin_cpu_supports( "avx2" ) )
+            {
+                name = "avx2";
+                return &avx2< IntType >;
+            }
+
+            name = "scalar";
+            return nullptr;
+        }
+
+        // AVX2 ---------------------------------------------------------------
+
+        template< class IntType >
+        __attribute__(( target( "avx2" ) ))
+        static std::size_t avx2( IntType * a, IntType * b,
+                                 std::size_t const count )
+        {
+            __m256i const one = _mm256_set1_epi32( 1 );
+
+            std::size_t i = 0;
+
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m256i x = _mm256_loadu_si256( ( __m256i const * )( a + i ) );
+                __m256i y = _mm256_loadu_si256( ( __m256i const * )( b + i ) );
+
+                while( !_mm256_testz_si256( x, x ) )
+                {
+                    __m256i const low = _mm256_min_epu32( x, y );
+                    __m256i const odd =
+                        _mm256_cmpeq_epi32( _mm256_and_si256( x, one ), one );
+                    __m256i const less = _mm256_andnot_si256
+                    (
+                        _mm256_cmpeq_epi32( x, y ),
+                        _mm256_cmpeq_epi32( low, x )
+                    );
+                    __m256i const diff =
+                        _mm256_sub_epi32( _mm256_max_epu32( x, y ), low );
+
+                    y = _mm256_blendv_epi8( y, x,
+                                            _mm256_and_si256( odd, less ) );
+                    x = _mm256_srli_epi32
+                    (
+                        _mm256_blendv_epi8( x, diff, odd ), 1
+                    );
+                }
+
+                _mm256_storeu_si256( ( __m256i * )( b + i ), y );
+            }
+
+            return i;
+        }
+
+        // AVX-512 ------------------------------------------------------------
+
+        template< class IntType >
+        __attribute__(( target( "avx512f,avx512cd" ) ))
+        static std::size_t avx512( IntType * a, IntType * b,
+                                   std::size_t const count )
+        {
+            __m512i const zero = _mm512_setzero_si512();
+            __m512i const topIndex = _mm512_set1_epi32( 31 );
+
+            std::size_t i = 0;
+
+            for( ; i + 16 <= count; i += 16 )
+            {
+                __m512i x = _mm512_loadu_si512( a + i );
+                __m512i y = _mm512_loadu_si512( b + i );
+
+                __mmask16 active = _mm512_test_epi32_mask( x, x );
+
+                while( active != 0 )
+                {
+                    __m512i const high =
+                        _mm512_mask_max_epu32( x, active, x, y );
+
+                    y = _mm512_mask_min_epu32( y, active, x, y );
+
+                    __m512i const diff =
+                        _mm512_mask_sub_epi32( zero, active, high, y );
+                    __m512i const bit = _mm512_and_si512
+                    (
+                        diff, _mm512_sub_epi32( zero, diff )
+                    );
+                    __m512i const zeros = _mm512_sub_epi32
+                    (
+                        topIndex, _mm512_maskz_lzcnt_epi32( active, bit )
+                    );
+
+                    x = _mm512_mask_srlv_epi32( x, active, diff, zeros );
+
+                    active = _mm512_test_epi32_mask( x, x );
+                }
+
+                _mm512_storeu_si512( b + i, y );
+            }
+
+            return i;
+        }
+    };
+
+    #endif // FRACT_BATCH_GCD_X86
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BATCH GCD CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Computes the GCDs of many pairs at once. For 32 and 64-bit builtin
+     *  unsigned types the pairs are spread across vector lanes, using the
+     *  widest kernel the CPU supports at run time, see [SimdGcdKernels].
+     *  Other types, and CPUs without a kernel, use [GcdEngine] per pair.
+     *
+     *  Powers of two and zero operands are handled per pair with a bit
+     *  count before and after the lanes run, so the kernels only ever see
+     *  odd operands.
+     */
+
+    template
+    <
+        class IntType,
+        bool HasKernels = std::is_integral< IntType >::value &&
+                          std::is_unsigned< IntType >::value &&
+                          ( sizeof( IntType ) == 4 || sizeof( IntType ) == 8 )
+    >
+    class BatchGcd
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GCD ----------------------------------------------------------------
+
+        /*  Sets [result][ i ] to the GCD of [lhs][ i ] and [rhs][ i ] for
+         *  each of the [count] pairs. [result] may be either operand.
+         */
+
+        static void gcd( IntType const * lhs,
+                         IntType const * rhs,
+                         IntType * result,
+                         std::size_t const count )
+        {
+            for( std::size_t i = 0; i < count; i += 1 )
+            {
+                result[ i ] = GcdEngine< IntType >::gcd( lhs[ i ], rhs[ i ] );
+            }
+        }
+
+        // KERNEL NAME --------------------------------------------------------
+
+        static char const * const kernelName( void )
+        {
+            return "scalar";
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    template< class IntType >
+    class BatchGcd< IntType, true >
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GCD ----------------------------------------------------------------
+
+        static void gcd( IntType const * lhs,
+                         IntType const * rhs,
+                         IntType * result,
+                         std::size_t const count )
+        {
+            kernel_type const kernel = getKernel().function;
+
+            if( kernel == nullptr )
+            {
+                BatchGcd< IntType, false >::gcd( lhs, rhs, result, count );
+                return;
+            }
+
+            // Strip powers of two, keeping the common power of each pair.
+            // A zero operand leaves the other as the GCD
+
+            std::vector< IntType > odd( count );
+            std::vector< unsigned char > shifts( count );
+
+            for( std::size_t i = 0; i < count; i += 1 )
+            {
+                IntType const a = lhs[ i ];
+                IntType const b = rhs[ i ];
+
+                if( a == 0 || b == 0 )
+                {
+                    odd[ i ] = 0;
+                    result[ i ] = IntType( a | b );
+                    shifts[ i ] = 0;
+                    continue;
+                }
+
+                odd[ i ] = IntType( a >> countTrailingZeros( a ) );
+                result[ i ] = IntType( b >> countTrailingZeros( b ) );
+                shifts[ i ] = countTrailingZeros( IntType( a | b ) );
+            }
+
+            // Run the lanes, finishing any partial vector one pair at a time
+
+            std::size_t const done = kernel( odd.data(), result, count );
+
+            for( std::size_t i = done; i < count; i += 1 )
+            {
+                result[ i ] = BinaryGcd< IntType >::gcd( odd[ i ],
+                                                         result[ i ] );
+            }
+
+            // Restore common powers of two
+
+            for( std::size_t i = 0; i < count; i += 1 )
+            {
+                result[ i ] = IntType( result[ i ] << shifts[ i ] );
+            }
+        }
+
+        // KERNEL NAME --------------------------------------------------------
+
+        /*  Names the kernel selected for this CPU.
+         */
+
+        static char const * const kernelName( void )
+        {
+            return getKernel().name;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef SimdGcdKernels< sizeof( IntType ) > kernels_type;
+
+        typedef typename kernels_type::template kernel_type< IntType >
+            kernel_type;
+
+        // KERNEL -------------------------------------------------------------
+
+        class Kernel
+        {
+            public:
+
+            Kernel( void ):
+            function( nullptr ),
+            name( nullptr )
+            {
+                this->function = kernels_type::template select< IntType >
+                                 ( this->name );
+            }
+
+            kernel_type function;
+            char const * name;
+        };
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GET KERNEL ---------------------------------------------------------
+
+        /*  CPU detection runs once, on first use.
+         */
+
+        static Kernel const & getKernel( void )
+        {
+            static Kernel const kernel;
+
+            return kernel;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // BATCH_GCD_H
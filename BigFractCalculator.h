@@ -0,0 +1,292 @@
+#ifndef BIG_FRACT_CALCULATOR_H
+#define BIG_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "FractComparator.h"
+#include "BigUnsigned.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    
+    template< class Calculator >
+    class fract;
+    
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BIG FRACT CALCULATOR CLASS +++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    
+    /*  Calculator over the arbitrary-precision [BigUnsigned], so results
+     *  are always exact. Components that fit in two limbs are stored inline,
+     *  and the cross-cancelling used below keeps them there for as long as
+     *  the values allow.
+     */
+
+    class BigFractCalculator
+    {
+        public:
+        
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+            
+        typedef BigUnsigned int_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+            
+        // ADD ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            // Get denominators
+
+            int_type const & lDenom = lhs.getDenominator();
+            int_type const & rDenom = rhs.getDenominator();
+
+            // Scale numerators to the least common multiple of denominators
+
+            int_type const divisor = gcd( lDenom, rDenom );
+            int_type const lScale = rDenom / divisor;
+            int_type const rScale = lDenom / divisor;
+
+            int_type const lNumer = lhs.getNumerator() * lScale;
+            int_type const rNumer = rhs.getNumerator() * rScale;
+
+            // Use signs to determine process
+
+            int_type numer = 0;
+            bool positive = lhs.isPositive();
+
+            if( lhs.isPositive() == rhs.isPositive() )
+            {
+                numer = lNumer + rNumer;
+            }
+            else
+            {
+                if( lNumer > rNumer )
+                {
+                    numer = lNumer - rNumer;
+                }
+                else
+                {
+                    numer = rNumer - lNumer;
+                    positive = rhs.isPositive();
+                }
+            }
+
+            // Check for zero numerator
+
+            if( numer == 0 )
+            {
+                return fract< Calc1 >( 0, true );
+            }
+
+            // Remove any part of the common factor shared with the numerator
+
+            int_type const common =
+                ( divisor == 1 ) ? int_type( 1 ) : gcd( numer, divisor );
+            return fract< Calc1 >::fromReduced( numer / common,
+                                                rScale * ( rDenom / common ),
+                                                positive );
+        }
+            
+        // MUL ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     rhs.getDenominator(),
+                                     lhs.isPositive() == rhs.isPositive() );
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
+            {
+                return fract< Calc1 >( 0, true );
+            }
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     lhs.isPositive() == rhs.isPositive() );
+        }
+        
+        // ARE EQUAL ----------------------------------------------------------
+        
+        template< class Calc1, class Calc2 >
+        static bool const areEqual( fract< Calc1 > const & lhs,
+                                    fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) == 0;
+        }
+        
+        // IS LESS ------------------------------------------------------------
+        
+        template< class Calc1, class Calc2 >
+        static bool const isLess( fract< Calc1 > const & lhs,
+                                  fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) < 0;
+        }
+        
+        // IS LESS OR EQUAL ---------------------------------------------------
+        
+        template< class Calc1, class Calc2 >
+        static bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) <= 0;
+        }
+        
+        // IS GREATER ---------------------------------------------------------
+        
+        template< class Calc1, class Calc2 >
+        static bool const isGreater( fract< Calc1 > const & lhs,
+                                     fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) > 0;
+        }
+        
+        // IS GREATER OR EQUAL ------------------------------------------------
+        
+        template< class Calc1, class Calc2 >
+        static bool const isGreaterOrEqual( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) >= 0;
+        }
+        
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        
+        // PI -----------------------------------------------------------------
+        
+        /*  The constant [PI] is initialised to
+         *  2646693125139304345/842468587426513207, which is accurate to 37
+         *  decimal places. This and similar fractions can be found at:
+         *  http://qin.laya.com/tech_projects_approxpi.html
+         */
+        
+        static fract< BigFractCalculator > const PI;
+        static fract< BigFractCalculator > const TWO_PI;
+        static fract< BigFractCalculator > const HALF_PI;
+        
+        // EULER'S CONSTANT ---------------------------------------------------
+        
+        /*  The constant [E] is initialised to 685/252, which is accurate to 4
+         *  decimal places. This fraction was calculated as a sum of the
+         *  infinite series:
+         *  e = sum( 1 / n! ) [0 <= n < infinity]
+         */
+        
+        static fract< BigFractCalculator > const E;
+        
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PRODUCT ------------------------------------------------------------
+
+        template< class Calc >
+        static fract< Calc > const product( int_type const & lNumer,
+                                            int_type const & lDenom,
+                                            int_type const & rNumer,
+                                            int_type const & rDenom,
+                                            bool const positive )
+        {
+            // Check for zero numerators
+
+            if( lNumer == 0 || rNumer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
+
+            // Cancel common factors across the operands
+
+            int_type const lCommon = gcd( lNumer, rDenom );
+            int_type const rCommon = gcd( rNumer, lDenom );
+
+            return fract< Calc >::fromReduced
+            (
+                ( lNumer / lCommon ) * ( rNumer / rCommon ),
+                ( lDenom / rCommon ) * ( rDenom / lCommon ),
+                positive
+            );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+    
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    
+    // PI ---------------------------------------------------------------------
+    
+    fract< BigFractCalculator > const
+    BigFractCalculator::PI =
+    fract< BigFractCalculator >( 2646693125139304345u,
+                                 842468587426513207u,
+                                 true );
+    
+    fract< BigFractCalculator > const
+    BigFractCalculator::TWO_PI =
+    BigFractCalculator::PI *
+    fract< BigFractCalculator >( 2, true );
+    
+    fract< BigFractCalculator > const
+    BigFractCalculator::HALF_PI = 
+    BigFractCalculator::PI /
+    fract< BigFractCalculator >( 2, true );
+    
+    // EULER'S CONSTANT -------------------------------------------------------
+    
+    fract< BigFractCalculator > const
+    BigFractCalculator::E = 
+    fract< BigFractCalculator >( 685, 252, true );
+    
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // BIG_FRACT_CALCULATOR_H
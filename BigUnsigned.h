@@ -0,0 +1,1490 @@
+#ifndef BIG_UNSIGNED_H
+#define BIG_UNSIGNED_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <cmath>
+
+#include "WideIntegerTraits.h"
+#include "GcdEngine.h"
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BIG UNSIGNED CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Arbitrary-precision unsigned integer stored as little-endian 64-bit
+     *  limbs. Values of up to [INLINE_LIMBS] limbs live inside the object,
+     *  larger values are moved to the heap. Multiplication switches from the
+     *  schoolbook method to Karatsuba once both operands reach
+     *  [KARATSUBA_THRESHOLD] limbs, and division uses Knuth's algorithm D.
+     *
+     *  The type behaves like a builtin unsigned integer except that it never
+     *  wraps: subtracting a larger value and dividing by zero are errors.
+     *  Conversions to builtin types are explicit. Results are returned by
+     *  non-const value so that they can be moved from.
+     */
+
+    class BigUnsigned
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef std::uint64_t limb_type;
+        typedef std::size_t size_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        static unsigned const LIMB_BITS = 64;
+        static unsigned const INLINE_LIMBS = 2;
+        static unsigned const KARATSUBA_THRESHOLD = 32;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        BigUnsigned( void )
+        {
+            this->count = 0;
+            this->capacity = INLINE_LIMBS;
+            this->local[ 0 ] = 0;
+            this->local[ 1 ] = 0;
+        }
+
+        BigUnsigned( limb_type const value )
+        {
+            this->count = ( value != 0 ) ? 1 : 0;
+            this->capacity = INLINE_LIMBS;
+            this->local[ 0 ] = value;
+            this->local[ 1 ] = 0;
+        }
+
+        // COPY CONSTRUCTOR ---------------------------------------------------
+
+        BigUnsigned( BigUnsigned const & other )
+        {
+            this->count = 0;
+            this->capacity = INLINE_LIMBS;
+
+            this->assign( other.limbs(), other.count );
+        }
+
+        // MOVE CONSTRUCTOR ---------------------------------------------------
+
+        BigUnsigned( BigUnsigned && other )
+        {
+            this->count = 0;
+            this->capacity = INLINE_LIMBS;
+
+            this->take( other );
+        }
+
+        // DESTRUCTOR ---------------------------------------------------------
+
+        ~BigUnsigned( void )
+        {
+            this->release();
+        }
+
+        // LIMB COUNT ---------------------------------------------------------
+
+        size_type const limbCount( void ) const
+        {
+            return this->count;
+        }
+
+        // GET LIMB -----------------------------------------------------------
+
+        /*  Returns the limb at [index], or zero beyond the most significant
+         *  limb.
+         */
+
+        limb_type const getLimb( size_type const index ) const
+        {
+            return ( index < this->count ) ? this->limbs()[ index ] : 0;
+        }
+
+        // IS ZERO ------------------------------------------------------------
+
+        bool const isZero( void ) const
+        {
+            return ( this->count == 0 );
+        }
+
+        // IS INLINE ----------------------------------------------------------
+
+        bool const isInline( void ) const
+        {
+            return ( this->capacity <= INLINE_LIMBS );
+        }
+
+        // BIT LENGTH ---------------------------------------------------------
+
+        size_type const bitLength( void ) const
+        {
+            if( this->count == 0 )
+            {
+                return 0;
+            }
+
+            return this->count * LIMB_BITS -
+                   countLeadingZeros( this->limbs()[ this->count - 1 ] );
+        }
+
+        // EXTRACT BITS -------------------------------------------------------
+
+        /*  Returns the 64 bits starting at bit [shift], which is the low limb
+         *  of the value shifted right by [shift].
+         */
+
+        limb_type const extractBits( size_type const shift ) const
+        {
+            size_type const index = shift / LIMB_BITS;
+            unsigned const offset = ( unsigned )( shift % LIMB_BITS );
+
+            limb_type bits = this->getLimb( index ) >> offset;
+
+            if( offset != 0 )
+            {
+                bits |= this->getLimb( index + 1 ) << ( LIMB_BITS - offset );
+            }
+
+            return bits;
+        }
+
+        // DIVIDE -------------------------------------------------------------
+
+        /*  Computes [quotient] and [remainder] of [dividend] by [divisor] in
+         *  one pass. The outputs may not alias the inputs.
+         */
+
+        static void divide( BigUnsigned const & dividend,
+                            BigUnsigned const & divisor,
+                            BigUnsigned & quotient,
+                            BigUnsigned & remainder )
+        {
+            DEBUG_CODE( assert( !( divisor.isZero() ) ) );
+            DEBUG_CODE( assert( &quotient != &dividend &&
+                                &quotient != &divisor &&
+                                &remainder != &dividend &&
+                                &remainder != &divisor ) );
+
+            // Check for dividend less than divisor
+
+            if( compare( dividend, divisor ) < 0 )
+            {
+                quotient = BigUnsigned();
+                remainder = dividend;
+                return;
+            }
+
+            // Divide single limbs directly
+
+            if( dividend.count == 1 )
+            {
+                limb_type const u = dividend.local[ 0 ];
+                limb_type const v = divisor.local[ 0 ];
+
+                quotient = BigUnsigned( u / v );
+                remainder = BigUnsigned( u % v );
+                return;
+            }
+
+            #if defined( __SIZEOF_INT128__ )
+
+            // Divide inline values directly
+
+            if( dividend.count <= 2 )
+            {
+                unsigned __int128 const u = dividend.toWide();
+                unsigned __int128 const v = divisor.toWide();
+
+                quotient.assignWide( u / v );
+                remainder.assignWide( u % v );
+                return;
+            }
+
+            #endif
+
+            // Divide by a single limb
+
+            if( divisor.count == 1 )
+            {
+                quotient.reserve( dividend.count );
+
+                limb_type const rem = divideLimbs( quotient.limbs(),
+                                                   dividend.limbs(),
+                                                   dividend.count,
+                                                   divisor.limbs()[ 0 ] );
+
+                quotient.count = dividend.count;
+                quotient.normalise();
+
+                remainder = BigUnsigned( rem );
+                return;
+            }
+
+            divideKnuth( dividend, divisor, quotient, remainder );
+        }
+
+        // COMPARE ------------------------------------------------------------
+
+        /*  Returns a negative value, zero or a positive value as [lhs] is
+         *  less than, equal to or greater than [rhs].
+         */
+
+        static int const compare( BigUnsigned const & lhs,
+                                  BigUnsigned const & rhs )
+        {
+            if( lhs.count != rhs.count )
+            {
+                return ( lhs.count < rhs.count ) ? -1 : 1;
+            }
+
+            limb_type const * const l = lhs.limbs();
+            limb_type const * const r = rhs.limbs();
+
+            for( size_type i = lhs.count; i > 0; i -= 1 )
+            {
+                if( l[ i - 1 ] != r[ i - 1 ] )
+                {
+                    return ( l[ i - 1 ] < r[ i - 1 ] ) ? -1 : 1;
+                }
+            }
+
+            return 0;
+        }
+
+        // SWAP ---------------------------------------------------------------
+
+        void swap( BigUnsigned & other )
+        {
+            BigUnsigned temp( std::move( other ) );
+
+            other = std::move( *this );
+            *this = std::move( temp );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC OPERATORS +++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // COPY ASSIGNMENT ----------------------------------------------------
+
+        BigUnsigned & operator = ( BigUnsigned const & other )
+        {
+            if( this != &other )
+            {
+                this->assign( other.limbs(), other.count );
+            }
+
+            return *this;
+        }
+
+        // MOVE ASSIGNMENT ----------------------------------------------------
+
+        BigUnsigned & operator = ( BigUnsigned && other )
+        {
+            if( this != &other )
+            {
+                this->release();
+                this->take( other );
+            }
+
+            return *this;
+        }
+
+        // CONVERSIONS --------------------------------------------------------
+
+        /*  Conversion to [limb_type] keeps the low 64 bits, as narrowing a
+         *  builtin unsigned type does. Floating-point conversions round.
+         */
+
+        explicit operator limb_type( void ) const
+        {
+            return this->getLimb( 0 );
+        }
+
+        explicit operator long double( void ) const
+        {
+            if( this->count <= 2 )
+            {
+                return ( long double )this->getLimb( 1 ) *
+                       18446744073709551616.0l +
+                       ( long double )this->getLimb( 0 );
+            }
+
+            // Only the top three limbs can affect the rounded result
+
+            size_type const low = this->count - 3;
+
+            long double const top =
+                ( ( long double )this->getLimb( low + 2 ) *
+                  18446744073709551616.0l +
+                  ( long double )this->getLimb( low + 1 ) ) *
+                18446744073709551616.0l +
+                ( long double )this->getLimb( low );
+
+            return std::ldexp( top, ( int )( low * LIMB_BITS ) );
+        }
+
+        explicit operator double( void ) const
+        {
+            return ( double )( long double )( *this );
+        }
+
+        explicit operator float( void ) const
+        {
+            return ( float )( long double )( *this );
+        }
+
+        // COMPOUND ASSIGNMENT ------------------------------------------------
+
+        BigUnsigned & operator += ( BigUnsigned const & rhs )
+        {
+            size_type const rCount = rhs.count;
+            size_type const size = std::max< size_type >( this->count, rCount );
+
+            this->reserve( size + 1 );
+
+            limb_type * const r = this->limbs();
+            limb_type const * const b = rhs.limbs();
+
+            std::fill( r + this->count, r + size + 1, 0 );
+
+            limb_type carry = 0;
+
+            for( size_type i = 0; i < rCount; i += 1 )
+            {
+                limb_type const sum = r[ i ] + b[ i ];
+                limb_type const total = sum + carry;
+
+                carry = ( sum < b[ i ] ) | ( total < sum );
+                r[ i ] = total;
+            }
+
+            for( size_type i = rCount; carry != 0; i += 1 )
+            {
+                r[ i ] += 1;
+                carry = ( r[ i ] == 0 );
+            }
+
+            this->count = size + 1;
+            this->normalise();
+
+            return *this;
+        }
+
+        BigUnsigned & operator -= ( BigUnsigned const & rhs )
+        {
+            DEBUG_CODE( assert( compare( *this, rhs ) >= 0 ) );
+
+            limb_type * const r = this->limbs();
+            limb_type const * const b = rhs.limbs();
+
+            limb_type borrow = 0;
+
+            for( size_type i = 0; i < rhs.count; i += 1 )
+            {
+                limb_type const diff = r[ i ] - b[ i ];
+                limb_type const total = diff - borrow;
+
+                borrow = ( r[ i ] < b[ i ] ) | ( diff < borrow );
+                r[ i ] = total;
+            }
+
+            for( size_type i = rhs.count; borrow != 0 && i < this->count;
+                 i += 1 )
+            {
+                borrow = ( r[ i ] == 0 );
+                r[ i ] -= 1;
+            }
+
+            this->normalise();
+
+            return *this;
+        }
+
+        BigUnsigned & operator *= ( BigUnsigned const & rhs )
+        {
+            return ( *this ) = multiply( *this, rhs );
+        }
+
+        BigUnsigned & operator /= ( BigUnsigned const & rhs )
+        {
+            BigUnsigned quotient;
+            BigUnsigned remainder;
+
+            divide( *this, rhs, quotient, remainder );
+
+            return ( *this ) = std::move( quotient );
+        }
+
+        BigUnsigned & operator %= ( BigUnsigned const & rhs )
+        {
+            DEBUG_CODE( assert( !( rhs.isZero() ) ) );
+
+            // A single limb divisor only needs the remainder
+
+            if( rhs.count == 1 && this->count > 2 )
+            {
+                BigUnsigned quotient( *this );
+
+                return ( *this ) = BigUnsigned
+                (
+                    divideLimbs( quotient.limbs(),
+                                 quotient.limbs(),
+                                 quotient.count,
+                                 rhs.limbs()[ 0 ] )
+                );
+            }
+
+            BigUnsigned quotient;
+            BigUnsigned remainder;
+
+            divide( *this, rhs, quotient, remainder );
+
+            return ( *this ) = std::move( remainder );
+        }
+
+        BigUnsigned & operator <<= ( size_type const shift )
+        {
+            if( this->count == 0 )
+            {
+                return *this;
+            }
+
+            size_type const limbShift = shift / LIMB_BITS;
+            unsigned const bitShift = ( unsigned )( shift % LIMB_BITS );
+            size_type const size = this->count + limbShift + 1;
+
+            this->reserve( size );
+
+            limb_type * const r = this->limbs();
+
+            if( bitShift == 0 )
+            {
+                r[ size - 1 ] = 0;
+
+                for( size_type i = this->count; i > 0; i -= 1 )
+                {
+                    r[ i - 1 + limbShift ] = r[ i - 1 ];
+                }
+            }
+            else
+            {
+                r[ size - 1 ] = r[ this->count - 1 ] >>
+                                ( LIMB_BITS - bitShift );
+
+                for( size_type i = this->count - 1; i > 0; i -= 1 )
+                {
+                    r[ i + limbShift ] =
+                        ( r[ i ] << bitShift ) |
+                        ( r[ i - 1 ] >> ( LIMB_BITS - bitShift ) );
+                }
+
+                r[ limbShift ] = r[ 0 ] << bitShift;
+            }
+
+            std::fill( r, r + limbShift, 0 );
+
+            this->count = size;
+            this->normalise();
+
+            return *this;
+        }
+
+        BigUnsigned & operator >>= ( size_type const shift )
+        {
+            size_type const limbShift = shift / LIMB_BITS;
+            unsigned const bitShift = ( unsigned )( shift % LIMB_BITS );
+
+            if( limbShift >= this->count )
+            {
+                this->count = 0;
+                return *this;
+            }
+
+            size_type const size = this->count - limbShift;
+            limb_type * const r = this->limbs();
+
+            if( bitShift == 0 )
+            {
+                for( size_type i = 0; i < size; i += 1 )
+                {
+                    r[ i ] = r[ i + limbShift ];
+                }
+            }
+            else
+            {
+                for( size_type i = 0; i + 1 < size; i += 1 )
+                {
+                    r[ i ] = ( r[ i + limbShift ] >> bitShift ) |
+                             ( r[ i + limbShift + 1 ] <<
+                               ( LIMB_BITS - bitShift ) );
+                }
+
+                r[ size - 1 ] = r[ this->count - 1 ] >> bitShift;
+            }
+
+            this->count = size;
+            this->normalise();
+
+            return *this;
+        }
+
+        // ARITHMETIC ---------------------------------------------------------
+
+        friend BigUnsigned operator + ( BigUnsigned lhs,
+                                        BigUnsigned const & rhs )
+        {
+            lhs += rhs;
+
+            return lhs;
+        }
+
+        friend BigUnsigned operator - ( BigUnsigned lhs,
+                                        BigUnsigned const & rhs )
+        {
+            lhs -= rhs;
+
+            return lhs;
+        }
+
+        friend BigUnsigned operator * ( BigUnsigned const & lhs,
+                                        BigUnsigned const & rhs )
+        {
+            return multiply( lhs, rhs );
+        }
+
+        friend BigUnsigned operator / ( BigUnsigned const & lhs,
+                                        BigUnsigned const & rhs )
+        {
+            BigUnsigned quotient;
+            BigUnsigned remainder;
+
+            divide( lhs, rhs, quotient, remainder );
+
+            return quotient;
+        }
+
+        friend BigUnsigned operator % ( BigUnsigned lhs,
+                                        BigUnsigned const & rhs )
+        {
+            lhs %= rhs;
+
+            return lhs;
+        }
+
+        friend BigUnsigned operator << ( BigUnsigned lhs,
+                                         size_type const shift )
+        {
+            lhs <<= shift;
+
+            return lhs;
+        }
+
+        friend BigUnsigned operator >> ( BigUnsigned lhs,
+                                         size_type const shift )
+        {
+            lhs >>= shift;
+
+            return lhs;
+        }
+
+        // COMPARISON ---------------------------------------------------------
+
+        friend bool const operator == ( BigUnsigned const & lhs,
+                                        BigUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) == 0;
+        }
+
+        friend bool const operator != ( BigUnsigned const & lhs,
+                                        BigUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) != 0;
+        }
+
+        friend bool const operator < ( BigUnsigned const & lhs,
+                                       BigUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) < 0;
+        }
+
+        friend bool const operator <= ( BigUnsigned const & lhs,
+                                        BigUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) <= 0;
+        }
+
+        friend bool const operator > ( BigUnsigned const & lhs,
+                                       BigUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) > 0;
+        }
+
+        friend bool const operator >= ( BigUnsigned const & lhs,
+                                        BigUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) >= 0;
+        }
+
+        // OUTPUT STREAM OPERATOR ---------------------------------------------
+
+        /*  Writes the value in decimal, peeling off 19 digits at a time.
+         */
+
+        friend std::ostream & operator << ( std::ostream & out,
+                                            BigUnsigned const & value )
+        {
+            static limb_type const CHUNK = 10000000000000000000ull;
+
+            if( value.count <= 1 )
+            {
+                return out << value.getLimb( 0 );
+            }
+
+            // Collect base 10^19 digits, least significant first
+
+            std::vector< limb_type > chunks;
+            BigUnsigned rest( value );
+
+            while( !( rest.isZero() ) )
+            {
+                chunks.push_back( divideLimbs( rest.limbs(),
+                                               rest.limbs(),
+                                               rest.count,
+                                               CHUNK ) );
+                rest.normalise();
+            }
+
+            // Write most significant chunk, then zero-padded chunks
+
+            out << chunks.back();
+
+            char const fill = out.fill( '0' );
+
+            for( size_type i = chunks.size() - 1; i > 0; i -= 1 )
+            {
+                out.width( 19 );
+                out << chunks[ i - 1 ];
+            }
+
+            out.fill( fill );
+
+            return out;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // LIMBS --------------------------------------------------------------
+
+        limb_type * limbs( void )
+        {
+            return this->isInline() ? this->local : this->heap;
+        }
+
+        limb_type const * limbs( void ) const
+        {
+            return this->isInline() ? this->local : this->heap;
+        }
+
+        // RESERVE ------------------------------------------------------------
+
+        /*  Ensures room for [size] limbs, preserving the current value.
+         */
+
+        void reserve( size_type const size )
+        {
+            if( size <= this->capacity )
+            {
+                return;
+            }
+
+            size_type const grown =
+                std::max< size_type >( size, 2 * this->capacity );
+            limb_type * const data = new limb_type[ grown ];
+
+            std::copy( this->limbs(), this->limbs() + this->count, data );
+
+            this->release();
+
+            this->heap = data;
+            this->capacity = ( std::uint32_t )grown;
+        }
+
+        // RELEASE ------------------------------------------------------------
+
+        void release( void )
+        {
+            if( !( this->isInline() ) )
+            {
+                delete[] this->heap;
+                this->capacity = INLINE_LIMBS;
+            }
+        }
+
+        // ASSIGN -------------------------------------------------------------
+
+        void assign( limb_type const * const data, size_type const size )
+        {
+            this->reserve( size );
+
+            std::copy( data, data + size, this->limbs() );
+
+            this->count = ( std::uint32_t )size;
+        }
+
+        // TAKE ---------------------------------------------------------------
+
+        /*  Moves the value of [other] into this empty object, leaving
+         *  [other] zero.
+         */
+
+        void take( BigUnsigned & other )
+        {
+            this->count = other.count;
+            this->capacity = other.capacity;
+
+            if( other.isInline() )
+            {
+                this->local[ 0 ] = other.local[ 0 ];
+                this->local[ 1 ] = other.local[ 1 ];
+            }
+            else
+            {
+                this->heap = other.heap;
+            }
+
+            other.count = 0;
+            other.capacity = INLINE_LIMBS;
+        }
+
+        // NORMALISE ----------------------------------------------------------
+
+        /*  Drops leading zero limbs so that [count] is minimal.
+         */
+
+        void normalise( void )
+        {
+            limb_type const * const r = this->limbs();
+
+            while( this->count > 0 && r[ this->count - 1 ] == 0 )
+            {
+                this->count -= 1;
+            }
+        }
+
+        #if defined( __SIZEOF_INT128__ )
+
+        // TO WIDE ------------------------------------------------------------
+
+        unsigned __int128 const toWide( void ) const
+        {
+            return ( ( unsigned __int128 )this->getLimb( 1 ) << 64 ) |
+                   this->getLimb( 0 );
+        }
+
+        // ASSIGN WIDE --------------------------------------------------------
+
+        void assignWide( unsigned __int128 const value )
+        {
+            limb_type * const r = this->limbs();
+
+            r[ 0 ] = ( limb_type )value;
+            r[ 1 ] = ( limb_type )( value >> 64 );
+
+            this->count = ( r[ 1 ] != 0 ) ? 2 : ( ( r[ 0 ] != 0 ) ? 1 : 0 );
+        }
+
+        #endif
+
+        // COUNT LEADING ZEROS ------------------------------------------------
+
+        static unsigned const countLeadingZeros( limb_type x )
+        {
+            DEBUG_CODE( assert( x != 0 ) );
+
+            #if defined( __GNUC__ )
+                return __builtin_clzll( x );
+            #else
+                unsigned count = 0;
+
+                while( ( x & ( ( limb_type )1 << 63 ) ) == 0 )
+                {
+                    x <<= 1;
+                    count += 1;
+                }
+
+                return count;
+            #endif
+        }
+
+        // MULTIPLY WIDE ------------------------------------------------------
+
+        /*  Returns the low limb of [a] * [b] and stores the high limb in
+         *  [high].
+         */
+
+        static limb_type const multiplyWide( limb_type const a,
+                                             limb_type const b,
+                                             limb_type & high )
+        {
+            #if defined( __SIZEOF_INT128__ )
+                unsigned __int128 const product = ( unsigned __int128 )a * b;
+
+                high = ( limb_type )( product >> 64 );
+
+                return ( limb_type )product;
+            #else
+                limb_type const mask = 0xffffffffu;
+
+                limb_type const ll = ( a & mask ) * ( b & mask );
+                limb_type const lh = ( a & mask ) * ( b >> 32 );
+                limb_type const hl = ( a >> 32 ) * ( b & mask );
+                limb_type const hh = ( a >> 32 ) * ( b >> 32 );
+
+                limb_type const mid = ( ll >> 32 ) + ( lh & mask ) +
+                                      ( hl & mask );
+
+                high = hh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 );
+
+                return ( mid << 32 ) | ( ll & mask );
+            #endif
+        }
+
+        // DIVIDE WIDE --------------------------------------------------------
+
+        /*  Divides the two limb value [high]:[low] by [divisor], which must
+         *  be greater than [high], returning the quotient and storing the
+         *  remainder in [remainder].
+         */
+
+        static limb_type const divideWide( limb_type const high,
+                                           limb_type const low,
+                                           limb_type const divisor,
+                                           limb_type & remainder )
+        {
+            DEBUG_CODE( assert( high < divisor ) );
+
+            #if defined( __SIZEOF_INT128__ )
+                unsigned __int128 const dividend =
+                    ( ( unsigned __int128 )high << 64 ) | low;
+
+                remainder = ( limb_type )( dividend % divisor );
+
+                return ( limb_type )( dividend / divisor );
+            #else
+                limb_type rem = high;
+                limb_type quotient = 0;
+
+                for( unsigned i = LIMB_BITS; i > 0; i -= 1 )
+                {
+                    bool const carry = ( rem >> 63 ) != 0;
+
+                    rem = ( rem << 1 ) | ( ( low >> ( i - 1 ) ) & 1 );
+                    quotient <<= 1;
+
+                    if( carry || rem >= divisor )
+                    {
+                        rem -= divisor;
+                        quotient |= 1;
+                    }
+                }
+
+                remainder = rem;
+
+                return quotient;
+            #endif
+        }
+
+        // DIVIDE LIMBS -------------------------------------------------------
+
+        /*  Divides [size] limbs of [a] by the single limb [divisor] into
+         *  [quotient], which may alias [a], and returns the remainder.
+         */
+
+        static limb_type const divideLimbs( limb_type * const quotient,
+                                            limb_type const * const a,
+                                            size_type const size,
+                                            limb_type const divisor )
+        {
+            limb_type rem = 0;
+
+            for( size_type i = size; i > 0; i -= 1 )
+            {
+                quotient[ i - 1 ] = divideWide( rem, a[ i - 1 ], divisor, rem );
+            }
+
+            return rem;
+        }
+
+        // MULTIPLY ADD LIMBS -------------------------------------------------
+
+        /*  Adds [size] limbs of [a] multiplied by [m] into [r] and returns
+         *  the carry out of the top limb.
+         */
+
+        static limb_type const multiplyAddLimbs( limb_type * const r,
+                                                 limb_type const * const a,
+                                                 size_type const size,
+                                                 limb_type const m )
+        {
+            limb_type carry = 0;
+
+            for( size_type i = 0; i < size; i += 1 )
+            {
+                limb_type high = 0;
+                limb_type low = multiplyWide( a[ i ], m, high );
+
+                low += carry;
+                high += ( low < carry );
+
+                r[ i ] += low;
+                high += ( r[ i ] < low );
+
+                carry = high;
+            }
+
+            return carry;
+        }
+
+        // MULTIPLY -----------------------------------------------------------
+
+        static BigUnsigned multiply( BigUnsigned const & a,
+                                     BigUnsigned const & b )
+        {
+            BigUnsigned result;
+
+            // Check for zero operands
+
+            if( a.count == 0 || b.count == 0 )
+            {
+                return result;
+            }
+
+            // Multiply single limbs inline
+
+            if( a.count == 1 && b.count == 1 )
+            {
+                limb_type * const r = result.limbs();
+
+                r[ 0 ] = multiplyWide( a.local[ 0 ], b.local[ 0 ], r[ 1 ] );
+                result.count = 2;
+                result.normalise();
+
+                return result;
+            }
+
+            // Use Karatsuba when both operands are large
+
+            size_type const shorter = std::min< size_type >( a.count, b.count );
+
+            if( shorter >= KARATSUBA_THRESHOLD )
+            {
+                return karatsuba( a, b );
+            }
+
+            // Schoolbook multiplication
+
+            size_type const size = a.count + b.count;
+
+            result.reserve( size );
+
+            limb_type * const r = result.limbs();
+            limb_type const * const x = a.limbs();
+            limb_type const * const y = b.limbs();
+
+            std::fill( r, r + size, 0 );
+
+            for( size_type i = 0; i < b.count; i += 1 )
+            {
+                r[ i + a.count ] =
+                    multiplyAddLimbs( r + i, x, a.count, y[ i ] );
+            }
+
+            result.count = ( std::uint32_t )size;
+            result.normalise();
+
+            return result;
+        }
+
+        // KARATSUBA ----------------------------------------------------------
+
+        /*  Splits each operand into halves a = a1 * B + a0 and computes the
+         *  product from three half-size products:
+         *  a * b = z2 * B^2 + ( ( a0 + a1 )( b0 + b1 ) - z2 - z0 ) * B + z0
+         */
+
+        static BigUnsigned karatsuba( BigUnsigned const & a,
+                                      BigUnsigned const & b )
+        {
+            size_type const longer = std::max< size_type >( a.count, b.count );
+            size_type const half = ( longer + 1 ) / 2;
+
+            BigUnsigned const a0 = a.lowLimbs( half );
+            BigUnsigned const a1 = a >> ( half * LIMB_BITS );
+            BigUnsigned const b0 = b.lowLimbs( half );
+            BigUnsigned const b1 = b >> ( half * LIMB_BITS );
+
+            BigUnsigned const z0 = multiply( a0, b0 );
+            BigUnsigned const z2 = multiply( a1, b1 );
+
+            BigUnsigned z1 = multiply( a0 + a1, b0 + b1 );
+
+            z1 -= z0;
+            z1 -= z2;
+
+            BigUnsigned result = z2 << ( half * LIMB_BITS );
+
+            result += z1;
+            result <<= half * LIMB_BITS;
+            result += z0;
+
+            return result;
+        }
+
+        // LOW LIMBS ----------------------------------------------------------
+
+        BigUnsigned lowLimbs( size_type const size ) const
+        {
+            BigUnsigned result;
+
+            result.assign( this->limbs(),
+                           std::min< size_type >( size, this->count ) );
+            result.normalise();
+
+            return result;
+        }
+
+        // DIVIDE KNUTH -------------------------------------------------------
+
+        /*  Knuth's algorithm D for a divisor of at least two limbs. Both
+         *  operands are normalised so the divisor's top bit is set, which
+         *  makes each estimated quotient limb at most two too large.
+         */
+
+        static void divideKnuth( BigUnsigned const & dividend,
+                                 BigUnsigned const & divisor,
+                                 BigUnsigned & quotient,
+                                 BigUnsigned & remainder )
+        {
+            size_type const n = divisor.count;
+            size_type const m = dividend.count - n;
+
+            unsigned const shift =
+                countLeadingZeros( divisor.limbs()[ n - 1 ] );
+
+            // Normalise operands
+
+            std::vector< limb_type > v( divisor.limbs(),
+                                        divisor.limbs() + n );
+
+            std::vector< limb_type > u( dividend.limbs(),
+                                        dividend.limbs() + dividend.count );
+
+            u.push_back( 0 );
+
+            if( shift != 0 )
+            {
+                for( size_type i = n - 1; i > 0; i -= 1 )
+                {
+                    v[ i ] = ( v[ i ] << shift ) |
+                             ( v[ i - 1 ] >> ( LIMB_BITS - shift ) );
+                }
+
+                v[ 0 ] <<= shift;
+
+                for( size_type i = dividend.count; i > 0; i -= 1 )
+                {
+                    u[ i ] = ( u[ i ] << shift ) |
+                             ( u[ i - 1 ] >> ( LIMB_BITS - shift ) );
+                }
+
+                u[ 0 ] <<= shift;
+            }
+
+            limb_type const vTop = v[ n - 1 ];
+            limb_type const vNext = v[ n - 2 ];
+
+            quotient.reserve( m + 1 );
+
+            limb_type * const q = quotient.limbs();
+
+            for( size_type j = m + 1; j > 0; j -= 1 )
+            {
+                limb_type * const w = &u[ j - 1 ];
+
+                // Estimate quotient limb from the top two dividend limbs
+
+                limb_type qhat = 0;
+                limb_type rhat = 0;
+                bool rhatOverflow = false;
+
+                if( w[ n ] >= vTop )
+                {
+                    qhat = ~( limb_type )0;
+                    rhat = w[ n - 1 ] + vTop;
+                    rhatOverflow = ( rhat < vTop );
+                }
+                else
+                {
+                    qhat = divideWide( w[ n ], w[ n - 1 ], vTop, rhat );
+                }
+
+                // Correct the estimate using the next divisor limb
+
+                while( !( rhatOverflow ) )
+                {
+                    limb_type high = 0;
+                    limb_type const low = multiplyWide( qhat, vNext, high );
+
+                    if( high < rhat || ( high == rhat && low <= w[ n - 2 ] ) )
+                    {
+                        break;
+                    }
+
+                    qhat -= 1;
+                    rhat += vTop;
+                    rhatOverflow = ( rhat < vTop );
+                }
+
+                // Multiply and subtract
+
+                limb_type carry = 0;
+                limb_type borrow = 0;
+
+                for( size_type i = 0; i < n; i += 1 )
+                {
+                    limb_type high = 0;
+                    limb_type low = multiplyWide( qhat, v[ i ], high );
+
+                    low += carry;
+                    high += ( low < carry );
+                    carry = high;
+
+                    limb_type const diff = w[ i ] - low;
+                    limb_type const total = diff - borrow;
+
+                    borrow = ( w[ i ] < low ) | ( diff < borrow );
+                    w[ i ] = total;
+                }
+
+                limb_type const diff = w[ n ] - carry;
+                limb_type const total = diff - borrow;
+
+                borrow = ( w[ n ] < carry ) | ( diff < borrow );
+                w[ n ] = total;
+
+                // Add back if the estimate was one too large
+
+                if( borrow != 0 )
+                {
+                    qhat -= 1;
+                    carry = 0;
+
+                    for( size_type i = 0; i < n; i += 1 )
+                    {
+                        limb_type const sum = w[ i ] + v[ i ];
+                        limb_type const added = sum + carry;
+
+                        carry = ( sum < v[ i ] ) | ( added < sum );
+                        w[ i ] = added;
+                    }
+
+                    w[ n ] += carry;
+                }
+
+                q[ j - 1 ] = qhat;
+            }
+
+            quotient.count = ( std::uint32_t )( m + 1 );
+            quotient.normalise();
+
+            // Denormalise remainder
+
+            remainder.assign( &u[ 0 ], n );
+            remainder.normalise();
+            remainder >>= shift;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        std::uint32_t count;
+        std::uint32_t capacity;
+
+        union
+        {
+            limb_type local[ INLINE_LIMBS ];
+            limb_type * heap;
+        };
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // LEHMER GCD CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Lehmer's GCD for [BigUnsigned]. The leading 62 bits of both operands
+     *  are run through Euclid's algorithm in machine words for as long as
+     *  the quotients are certain, and the accumulated cofactors are then
+     *  applied to the full operands at once. A full remainder step is taken
+     *  only when no quotient can be determined. Once the smaller operand
+     *  fits inline the binary engine finishes the job.
+     */
+
+    class LehmerGcd
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GCD ----------------------------------------------------------------
+
+        static BigUnsigned gcd( BigUnsigned a, BigUnsigned b )
+        {
+            typedef std::int64_t cofactor_type;
+
+            if( a < b )
+            {
+                a.swap( b );
+            }
+
+            while( b.limbCount() > BigUnsigned::INLINE_LIMBS )
+            {
+                // Take leading bits of both operands at the same scale
+
+                BigUnsigned::size_type const shift = a.bitLength() - 62;
+
+                cofactor_type x = ( cofactor_type )a.extractBits( shift );
+                cofactor_type y = ( cofactor_type )b.extractBits( shift );
+
+                cofactor_type A = 1;
+                cofactor_type B = 0;
+                cofactor_type C = 0;
+                cofactor_type D = 1;
+
+                // Run Euclid on leading bits while quotients agree
+
+                for( ;; )
+                {
+                    if( y + C <= 0 || y + D <= 0 )
+                    {
+                        break;
+                    }
+
+                    cofactor_type const q = ( x + A ) / ( y + C );
+
+                    if( q != ( x + B ) / ( y + D ) )
+                    {
+                        break;
+                    }
+
+                    cofactor_type t = A - q * C;
+
+                    A = C;
+                    C = t;
+                    t = B - q * D;
+                    B = D;
+                    D = t;
+                    t = x - q * y;
+                    x = y;
+                    y = t;
+                }
+
+                // Apply cofactors, or a full remainder step if none were
+                // found
+
+                if( B == 0 )
+                {
+                    a %= b;
+                    a.swap( b );
+                }
+                else
+                {
+                    BigUnsigned nextA = combine( a, A, b, B );
+                    BigUnsigned nextB = combine( a, C, b, D );
+
+                    a = std::move( nextA );
+                    b = std::move( nextB );
+                }
+            }
+
+            // Finish with machine arithmetic
+
+            if( b.isZero() )
+            {
+                return a;
+            }
+
+            a %= b;
+
+            if( b.limbCount() == 1 )
+            {
+                return BigUnsigned
+                (
+                    GcdEngine< BigUnsigned::limb_type >::gcd( a.getLimb( 0 ),
+                                                              b.getLimb( 0 ) )
+                );
+            }
+
+            #if defined( __SIZEOF_INT128__ )
+
+            typedef unsigned __int128 wide_type;
+
+            wide_type const result = GcdEngine< wide_type >::gcd
+            (
+                ( ( wide_type )a.getLimb( 1 ) << 64 ) | a.getLimb( 0 ),
+                ( ( wide_type )b.getLimb( 1 ) << 64 ) | b.getLimb( 0 )
+            );
+
+            return ( BigUnsigned( ( BigUnsigned::limb_type )( result >> 64 ) )
+                     << 64 ) +
+                   BigUnsigned( ( BigUnsigned::limb_type )result );
+
+            #else
+
+            return EuclideanGcd< BigUnsigned >::gcd( a, b );
+
+            #endif
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // COMBINE ------------------------------------------------------------
+
+        /*  Returns [x] * [xScale] + [y] * [yScale] for cofactors of opposite
+         *  sign, where the result is known to be non-negative.
+         */
+
+        static BigUnsigned combine( BigUnsigned const & x,
+                                    std::int64_t const xScale,
+                                    BigUnsigned const & y,
+                                    std::int64_t const yScale )
+        {
+            typedef BigUnsigned::limb_type limb_type;
+
+            if( yScale <= 0 )
+            {
+                return x * BigUnsigned( ( limb_type )xScale ) -
+                       y * BigUnsigned( ( limb_type )( -yScale ) );
+            }
+
+            return y * BigUnsigned( ( limb_type )yScale ) -
+                   x * BigUnsigned( ( limb_type )( -xScale ) );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ENGINE AND TRAITS SPECIALISATIONS ++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template<>
+    class GcdEngine< BigUnsigned > : public LehmerGcd
+    {
+    };
+
+    /*  Products of [BigUnsigned] cannot overflow, so it is its own wide
+     *  type.
+     */
+
+    template<>
+    class WideIntegerTraits< BigUnsigned, false >
+    {
+        public:
+
+        static bool const hasWideType = true;
+        typedef BigUnsigned wide_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NUMERIC LIMITS +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/*  [BigUnsigned] is unbounded. [digits] and [max] describe a single limb,
+ *  which is the range fract converts exactly from floating point.
+ */
+
+namespace std
+{
+    template<>
+    class numeric_limits< fract::BigUnsigned >
+    {
+        public:
+
+        static bool const is_specialized = true;
+        static bool const is_signed = false;
+        static bool const is_integer = true;
+        static bool const is_exact = true;
+        static bool const is_bounded = false;
+        static bool const is_modulo = false;
+
+        static int const radix = 2;
+        static int const digits = 64;
+        static int const digits10 = 19;
+
+        static fract::BigUnsigned const min( void )
+        {
+            return fract::BigUnsigned();
+        }
+
+        static fract::BigUnsigned const lowest( void )
+        {
+            return fract::BigUnsigned();
+        }
+
+        static fract::BigUnsigned const max( void )
+        {
+            return fract::BigUnsigned( ~( std::uint64_t )0 );
+        }
+    };
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // BIG_UNSIGNED_H
@@ -0,0 +1,436 @@
+#ifndef BOUNDED_FRACT_CALCULATOR_H
+#define BOUNDED_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+#include <limits>
+
+#include "WideIntegerTraits.h"
+#include "FractComparator.h"
+#include "FractStorage.h"
+#include "ErrorPolicy.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BOUNDED FRACT CALCULATOR CLASS +++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Computes each result exactly in the unsigned type of twice the width
+     *  of [IntType], as [BasicWideFractCalculator] does, then snaps it to
+     *  the closest fraction whose denominator does not exceed
+     *  [MaxDenominator] with [limitDenominator]. Operands stay the same
+     *  size however long a computation runs, so each operation costs about
+     *  the same. Each result is within 1 / ( [MaxDenominator] + 1 ) of the
+     *  exact one, and usually much closer.
+     *
+     *  Results whose numerators do not fit [IntType], and sums that carry
+     *  out of the wide type, are handed to [ErrorPolicy], which by default
+     *  throws [UnsafeOperationException].
+     */
+
+    template
+    <
+        std::uint64_t MaxDenominator,
+        class IntType = std::uint64_t,
+        class ErrorPolicy = ThrowingErrorPolicy
+    >
+    class BoundedFractCalculator
+    {
+        static_assert( WideIntegerTraits< IntType >::hasWideType &&
+                       sizeof( IntType ) >= 4,
+                       "components need a builtin type of twice the width" );
+
+        static_assert( MaxDenominator > 0 &&
+                       MaxDenominator <= std::uint64_t(
+                           std::numeric_limits< IntType >::max() ),
+                       "the bound must be a positive value of the components" );
+
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+        typedef typename WideIntegerTraits< IntType >::wide_type wide_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            // Get fraction components
+
+            int_type const lDenom = lhs.getDenominator();
+            int_type const rDenom = rhs.getDenominator();
+
+            // Scale numerators to the least common multiple of denominators
+
+            int_type const divisor = gcd( lDenom, rDenom );
+            int_type const lScale = rDenom / divisor;
+            int_type const rScale = lDenom / divisor;
+
+            wide_type const lNumer = ( wide_type )lhs.getNumerator() * lScale;
+            wide_type const rNumer = ( wide_type )rhs.getNumerator() * rScale;
+            wide_type denom = ( wide_type )lDenom * lScale;
+
+            // Use signs to determine process
+
+            wide_type numer = 0;
+            bool positive = lhs.isPositive();
+
+            if( lhs.isPositive() == rhs.isPositive() )
+            {
+                numer = lNumer + rNumer;
+
+                if( numer < lNumer )
+                {
+                    return ErrorPolicy::template fail< Calc1 >();
+                }
+            }
+            else
+            {
+                if( lNumer > rNumer )
+                {
+                    numer = lNumer - rNumer;
+                }
+                else
+                {
+                    numer = rNumer - lNumer;
+                    positive = rhs.isPositive();
+                }
+            }
+
+            // Only the common factor of the denominators can divide the
+            // numerator, so reduce against it with a narrow GCD
+
+            if( numer != 0 && divisor != 1 )
+            {
+                int_type const common =
+                    gcd( ( int_type )( numer % divisor ), divisor );
+
+                numer /= common;
+                denom = ( wide_type )rScale * ( rDenom / common );
+            }
+
+            return snap< Calc1 >( numer, denom, positive );
+        }
+
+        // MUL ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     rhs.getDenominator(),
+                                     lhs.isPositive() == rhs.isPositive() );
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
+            {
+                return fract< Calc1 >( 0, true );
+            }
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     lhs.isPositive() == rhs.isPositive() );
+        }
+
+        // ARE EQUAL ----------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) == 0;
+        }
+
+        // IS LESS ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) < 0;
+        }
+
+        // IS LESS OR EQUAL ---------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) <= 0;
+        }
+
+        // IS GREATER ---------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) > 0;
+        }
+
+        // IS GREATER OR EQUAL ------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) >= 0;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PI -----------------------------------------------------------------
+
+        /*  The constants are the closest fractions within the bound to
+         *  2646693125139304345/842468587426513207, which is accurate to 37
+         *  decimal places, its double and its half.
+         */
+
+        static fract< BoundedFractCalculator > const PI;
+        static fract< BoundedFractCalculator > const TWO_PI;
+        static fract< BoundedFractCalculator > const HALF_PI;
+
+        // EULER'S CONSTANT ---------------------------------------------------
+
+        /*  The constant [E] is the closest fraction within the bound to
+         *  685/252, which is accurate to 4 decimal places.
+         */
+
+        static fract< BoundedFractCalculator > const E;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PRODUCT ------------------------------------------------------------
+
+        template< class Calc >
+        static constexpr fract< Calc > const product( int_type const lNumer,
+                                                      int_type const lDenom,
+                                                      int_type const rNumer,
+                                                      int_type const rDenom,
+                                                      bool const positive )
+        {
+            // Check for zero numerators
+
+            if( lNumer == 0 || rNumer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
+
+            // Cancel common factors across the operands
+
+            int_type const lCommon = gcd( lNumer, rDenom );
+            int_type const rCommon = gcd( rNumer, lDenom );
+
+            wide_type const numer =
+                ( wide_type )( lNumer / lCommon ) * ( rNumer / rCommon );
+
+            wide_type const denom =
+                ( wide_type )( lDenom / rCommon ) * ( rDenom / lCommon );
+
+            return snap< Calc >( numer, denom, positive );
+        }
+
+        // SNAP ---------------------------------------------------------------
+
+        /*  Returns the closest fraction to [numer]/[denom], which must be in
+         *  lowest terms, that fits the storage of [Calc].
+         */
+
+        template< class Calc >
+        static constexpr fract< Calc > const snap( wide_type numer,
+                                                   wide_type denom,
+                                                   bool const positive )
+        {
+            int_type const limit =
+                fract< Calc >::storage_type::maxDenominator();
+
+            // Narrow division is much cheaper, so expand the continued
+            // fraction in [int_type] when both components fit
+
+            if( ( numer >> intBits ) == 0 && ( denom >> intBits ) == 0 )
+            {
+                int_type narrowNumer = ( int_type )numer;
+                int_type narrowDenom = ( int_type )denom;
+
+                limitDenominator( narrowNumer, narrowDenom, limit );
+
+                numer = narrowNumer;
+                denom = narrowDenom;
+            }
+            else
+            {
+                limitDenominator( numer, denom, wide_type( limit ) );
+            }
+
+            if( numer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
+
+            if( ( numer >> intBits ) != 0 )
+            {
+                return ErrorPolicy::template fail< Calc >();
+            }
+
+            return fract< Calc >::fromReduced( ( int_type )numer,
+                                               ( int_type )denom,
+                                               positive );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // INTEGER BITS -------------------------------------------------------
+
+        static constexpr unsigned const intBits =
+            std::numeric_limits< int_type >::digits;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FRACT STORAGE TRAITS SPECIALISATION ++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< std::uint64_t MaxDenominator, class IntType, class ErrorPolicy >
+    class FractStorageTraits
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    {
+        public:
+
+        typedef BoundedFractStorage< IntType, MaxDenominator > storage_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // PI ---------------------------------------------------------------------
+
+    /*  [TWO_PI] and [HALF_PI] are snapped from the full-precision fractions
+     *  rather than computed from a snapped [PI], which would double its
+     *  error.
+     */
+
+    template< std::uint64_t MaxDenominator, class IntType, class ErrorPolicy >
+    constexpr fract
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    const
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::TWO_PI =
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::template
+    snap
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    ( 5293386250278608690u, 842468587426513207u, true );
+
+    template< std::uint64_t MaxDenominator, class IntType, class ErrorPolicy >
+    constexpr fract
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    const
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::HALF_PI =
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::template
+    snap
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    ( 2646693125139304345u, 1684937174853026414u, true );
+
+    template< std::uint64_t MaxDenominator, class IntType, class ErrorPolicy >
+    constexpr fract
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    const
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::PI =
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::template
+    snap
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    ( 2646693125139304345u, 842468587426513207u, true );
+
+    // EULER'S CONSTANT -------------------------------------------------------
+
+    template< std::uint64_t MaxDenominator, class IntType, class ErrorPolicy >
+    constexpr fract
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    const
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::E =
+    BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >::template
+    snap
+    <
+        BoundedFractCalculator< MaxDenominator, IntType, ErrorPolicy >
+    >
+    ( 685, 252, true );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // BOUNDED_FRACT_CALCULATOR_H
@@ -5,10 +5,15 @@
 // INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
-#include <exception>
+#include <type_traits>
 #include <cstdint>
 
+#include "UnsafeOperationException.h"
 #include "SafeFractCalculator.h"
+#include "WideFractCalculator.h"
+#include "OverflowArithmetic.h"
+#include "WideIntegerTraits.h"
+#include "FractComparator.h"
 #include "debug.h"
 #include "fract.h"
 
@@ -26,34 +31,19 @@ namespace fract
     class fract;
     
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // UNSAFE OPERATION CLASS +++++++++++++++++++++++++++++++++++++++++++++++++
+    // BASIC CHECKED SAFE FRACT CALCULATOR CLASS +++++++++++++++++++++++++++++
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    
-    class UnsafeOperationException : public std::exception
-    {
-        public:
-        
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        
-        // WHAT ---------------------------------------------------------------
-            
-        virtual char const * what( void ) const throw()
-        {
-            return "Unsafe operation detected";
-        }
-            
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    }
-    
-    UnsafeOperation;
-    
-    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // SAFE FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++++++++++++++
-    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    
-    class CheckedSafeFractCalculator
+
+    /*  Performs exact arithmetic on fractions in lowest terms, falling back
+     *  to floating-point for results that cannot be represented. Every
+     *  step is done in 64 bits and checked with the static [addOverflows]
+     *  and [mulOverflows] of [OverflowCheck]; [DivisionOverflowCheck]
+     *  gives the portable checks this calculator used to make. A sum whose
+     *  steps overflow is retried in 128 bits where available.
+     */
+
+    template< class OverflowCheck = BuiltinOverflowCheck >
+    class BasicCheckedSafeFractCalculator
     {
         public:
         
@@ -69,323 +59,109 @@ namespace fract
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         
         // ADD ----------------------------------------------------------------
-            
+
         template< class Calc1, class Calc2 >
-        static fract< Calc1 > const add( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
-            // Copy fractions
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            // Attempt to equalise fractions and check addition safety
-            
-            if( equalise( clhs, crhs ) )
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            fract< Calc1 > result;
+
+            if( trySum( lhs, rhs, result ) ||
+                tryWideSum( lhs, rhs, result, has_wide_type() ) )
             {
-                // Get numerators
-                
-                int_type lNumer = clhs.getNumerator();
-                int_type rNumer = crhs.getNumerator();
-                
-                // Check addition is safe
-
-                if( isAdditionSafe( lNumer, rNumer ) )
-                {
-                    // Perform addition based on sign
-                    
-                    if( clhs.isPositive() == crhs.isPositive() )
-                    {
-                        lNumer += rNumer;
-                    }
-                    else
-                    {
-                        if( lNumer > rNumer )
-                        {
-                            lNumer -= rNumer;
-                        }
-                        else
-                        {
-                            lNumer = rNumer - lNumer;
-                            clhs.negate();
-                        }
-                    }
-
-                    // Return result
-
-                    return fract< Calc1 >( lNumer,
-                                           clhs.getDenominator(),
-                                           clhs.isPositive() );
-                }
+                return result;
             }
-            
+
             // Convert fractions to floating-point types and add
-            
+
             return fract< Calc1 >( toFloatingPoint( lhs ) +
                                    toFloatingPoint( rhs ) );
         }
-        
+
         // MUL ----------------------------------------------------------------
-            
+
         template< class Calc1, class Calc2 >
-        static fract< Calc1 > const mul( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
             DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
                                 rhs.getDenominator() > 0 ) );
 
-            // Determine sign of result
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     rhs.getDenominator(),
+                                     lhs.isPositive() == rhs.isPositive() );
+        }
 
-            bool positive = true;
+        // DIV ----------------------------------------------------------------
 
-            if( lhs.isPositive() == rhs.isPositive() )
-            {
-                positive = true;
-            }
-            else
-            {
-                positive = false;
-            }
-            
-            // Get fraction components
-                
-            int_type lNumer = lhs.getNumerator();
-            int_type lDenom = lhs.getDenominator();
-            int_type rNumer = rhs.getNumerator();
-            int_type rDenom = rhs.getDenominator();
-            
-            // Check to see if multiplication is safe
-            
-            if( isMultiplicationSafe( lNumer, rNumer ) &&
-                isMultiplicationSafe( lDenom, rDenom ) )
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
             {
-                // Multiply LHS with RHS
-                
-                lNumer *= rNumer;
-                lDenom *= rDenom;
-                
-                // Return result
-                
-                return fract< Calc1 >( lNumer, lDenom, positive );
+                return fract< Calc1 >( 0, true );
             }
-            
-            // Convert fractions to floating-point types and multiply
-            
-            return fract< Calc1 >( toFloatingPoint( lhs ) *
-                                   toFloatingPoint( rhs ) );
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     lhs.isPositive() == rhs.isPositive() );
         }
         
         // ARE EQUAL ----------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const areEqual( fract< Calc1 > const & lhs,
-                                    fract< Calc2 > const & rhs )
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
         {
-            // Check signs
-            
-            if( lhs.isPositive() != rhs.isPositive() )
-            {
-                return false;
-            }
-            
-            // Copy fractions
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            // Attempt to equalise
-            
-            if( equalise( clhs, crhs ) )
-            {
-                // Return result of numerator comparison
-                
-                return ( clhs.getNumerator() == crhs.getNumerator() );
-            }
-            
-            // Equalise has failed, compare floating-point conversions
-            
-            float_type flhs = toFloatingPoint( lhs );
-            float_type frhs = toFloatingPoint( rhs );
-            
-            flhs = std::abs( flhs - frhs );
-            
-            return flhs < std::numeric_limits< float_type >::epsilon();
+            return FractComparator::compare( lhs, rhs ) == 0;
         }
         
         // IS LESS ------------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isLess( fract< Calc1 > const & lhs,
-                                  fract< Calc2 > const & rhs )
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
         {
-            // Copy fractions
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            // Attempt to equalise
-            
-            if( equalise( clhs, crhs ) )
-            {
-                // Compare signs
-            
-                if( clhs.isPositive() )
-                {
-                    if( crhs.isNegative() )
-                    {
-                        return false;
-                    }
-
-                    return clhs.getNumerator() < crhs.getNumerator();
-                }
-                else
-                {
-                    if( rhs.isPositive() )
-                    {
-                        return true;
-                    }
-
-                    return clhs.getNumerator() > crhs.getNumerator();
-                }
-            }
-            
-            // Equalise has failed, compare floating-point conversions
-            
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-            
-            return ( diff + EPSILON ) > 0;
+            return FractComparator::compare( lhs, rhs ) < 0;
         }
         
         // IS LESS OR EQUAL ---------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isLessOrEqual( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
-            // Copy fractions
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            // Attempt to equalise
-            
-            if( equalise( clhs, crhs ) )
-            {
-                // Compare signs
-            
-                if( clhs.isPositive() )
-                {
-                    if( crhs.isNegative() )
-                    {
-                        return false;
-                    }
-
-                    return clhs.getNumerator() <= crhs.getNumerator();
-                }
-                else
-                {
-                    if( rhs.isPositive() )
-                    {
-                        return true;
-                    }
-
-                    return clhs.getNumerator() >= crhs.getNumerator();
-                }
-            }
-            
-            // Equalise has failed, compare floating-point conversions
-            
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-
-            return ( std::abs( diff ) < EPSILON ) || ( diff + EPSILON > 0 );
+            return FractComparator::compare( lhs, rhs ) <= 0;
         }
         
         // IS GREATER ---------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isGreater( fract< Calc1 > const & lhs,
-                                     fract< Calc2 > const & rhs )
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
         {
-            // Copy fractions
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            // Attempt to equalise
-            
-            if( equalise( clhs, crhs ) )
-            {
-                // Compare signs
-            
-                if( lhs.isPositive() )
-                {
-                    if( rhs.isNegative() )
-                    {
-                        return true;
-                    }
-
-                    return clhs.getNumerator() > crhs.getNumerator();
-                }
-                else
-                {
-                    if( rhs.isPositive() )
-                    {
-                        return false;
-                    }
-
-                    return clhs.getNumerator() < crhs.getNumerator();
-                }
-            }
-            
-            // Equalise has failed, compare floating-point conversions
-            
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-            
-            return ( diff + EPSILON ) < 0;
+            return FractComparator::compare( lhs, rhs ) > 0;
         }
         
         // IS GREATER OR EQUAL ------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isGreaterOrEqual( fract< Calc1 > const & lhs,
-                                            fract< Calc2 > const & rhs )
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
         {
-            // Copy fractions
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            // Attempt to equalise
-            
-            if( equalise( clhs, crhs ) )
-            {
-                // Compare signs
-            
-                if( lhs.isPositive() )
-                {
-                    if( rhs.isNegative() )
-                    {
-                        return true;
-                    }
-
-                    return clhs.getNumerator() >= crhs.getNumerator();
-                }
-                else
-                {
-                    if( rhs.isPositive() )
-                    {
-                        return false;
-                    }
-
-                    return clhs.getNumerator() <= crhs.getNumerator();
-                }
-            }
-            
-            // Equalise has failed, compare floating-point conversions
-            
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-
-            return ( std::abs( diff ) < EPSILON ) || ( diff + EPSILON < 0 );
+            return FractComparator::compare( lhs, rhs ) >= 0;
         }
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -400,9 +176,9 @@ namespace fract
          *  http://qin.laya.com/tech_projects_approxpi.html
          */
         
-        static fract< CheckedSafeFractCalculator > const PI;
-        static fract< CheckedSafeFractCalculator > const TWO_PI;
-        static fract< CheckedSafeFractCalculator > const HALF_PI;
+        static fract< BasicCheckedSafeFractCalculator > const PI;
+        static fract< BasicCheckedSafeFractCalculator > const TWO_PI;
+        static fract< BasicCheckedSafeFractCalculator > const HALF_PI;
         
         // EULER'S CONSTANT ---------------------------------------------------
         
@@ -412,80 +188,194 @@ namespace fract
          *  e = sum( 1 / n! ) [0 <= n < infinity]
          */
         
-        static fract< CheckedSafeFractCalculator > const E;
+        static fract< BasicCheckedSafeFractCalculator > const E;
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         
         private:
         
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef std::integral_constant< bool, UnsignedOfSize< 16 >::exists >
+            has_wide_type;
+
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
          
-        // EQUALISE -----------------------------------------------------------
-        
+        // TRY SUM ------------------------------------------------------------
+
+        /*  Sets [result] to the exact sum of [lhs] and [rhs] and returns
+         *  true if every step fits 64 bits, checked with [OverflowCheck].
+         */
+
         template< class Calc1, class Calc2 >
-        static bool const equalise( fract< Calc1 > & lhs,
-                                    fract< Calc2 > & rhs )
+        static constexpr bool const trySum( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs,
+                                            fract< Calc1 > & result )
         {
-            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
-                                rhs.getDenominator() > 0 ) );
-            
-            // Get denominators
-            
-            int_type lDenom = lhs.getDenominator();
-            int_type rDenom = rhs.getDenominator();
-            
-            // Check to see if denominators can be multiplied
-            
-            if( !( isMultiplicationSafe( lDenom, rDenom ) ) )
+            // Get fraction components
+
+            int_type const lNumer = lhs.getNumerator();
+            int_type const lDenom = lhs.getDenominator();
+            int_type const rNumer = rhs.getNumerator();
+            int_type const rDenom = rhs.getDenominator();
+
+            // Find scales to the least common multiple of denominators
+
+            int_type const divisor = gcd( lDenom, rDenom );
+            int_type const lScale = rDenom / divisor;
+            int_type const rScale = lDenom / divisor;
+
+            // Scale numerators, checking each step
+
+            int_type lTerm = 0;
+            int_type rTerm = 0;
+            int_type numer = 0;
+
+            bool const sameSign = lhs.isPositive() == rhs.isPositive();
+            bool positive = lhs.isPositive();
+
+            bool overflow =
+                OverflowCheck::mulOverflows( lNumer, lScale, lTerm ) ||
+                OverflowCheck::mulOverflows( rNumer, rScale, rTerm );
+
+            // Perform addition based on sign
+
+            if( !overflow )
             {
-                return false;
+                if( sameSign )
+                {
+                    overflow = OverflowCheck::addOverflows( lTerm,
+                                                            rTerm,
+                                                            numer );
+                }
+                else if( lTerm > rTerm )
+                {
+                    numer = lTerm - rTerm;
+                }
+                else
+                {
+                    numer = rTerm - lTerm;
+                    positive = rhs.isPositive();
+                }
             }
-            
-            // Calculate least common multiple of denominators
-                
-            int_type lcm = ( lDenom * rDenom ) / gcd( lDenom, rDenom );
-            
-            // Check LHS components can be multiplied
-            
-            int_type lNumer = lhs.getNumerator();
-            
-            int_type mul = lcm / lDenom;
-            
-            if( !( isMultiplicationSafe( mul, lNumer ) ) ||
-                !( isMultiplicationSafe( mul, lDenom ) ) )
+
+            if( !overflow )
+            {
+                // Check for zero numerator
+
+                if( numer == 0 )
+                {
+                    result = fract< Calc1 >( 0, true );
+                    return true;
+                }
+
+                // Remove any part of the common factor shared with the
+                // numerator and check the denominator fits the storage
+
+                int_type const common =
+                    ( divisor == 1 ) ? 1 : gcd( numer, divisor );
+
+                int_type denom = 0;
+
+                if( !OverflowCheck::mulOverflows( rScale,
+                                                  rDenom / common,
+                                                  denom ) &&
+                    denom <= fract< Calc1 >::storage_type::maxDenominator() )
+                {
+                    result = fract< Calc1 >::fromReduced( numer / common,
+                                                          denom,
+                                                          positive );
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // TRY WIDE SUM -------------------------------------------------------
+
+        /*  As [trySum], but with [BasicWideFractCalculator::tryAdd], which
+         *  forms the sum in 128 bits and checks only the reduced result.
+         *  Without a 128-bit type there is nothing further to try.
+         */
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const tryWideSum( fract< Calc1 > const & lhs,
+                                                fract< Calc2 > const & rhs,
+                                                fract< Calc1 > & result,
+                                                std::true_type )
+        {
+            typedef BasicWideFractCalculator
+            <
+                typename fract< Calc1 >::int_type
+            >
+            exact_type;
+
+            return exact_type::tryAdd( lhs, rhs, result );
+        }
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const tryWideSum( fract< Calc1 > const &,
+                                                fract< Calc2 > const &,
+                                                fract< Calc1 > &,
+                                                std::false_type )
+        {
+            return false;
+        }
+
+        // PRODUCT ------------------------------------------------------------
+
+        template< class Calc >
+        static constexpr fract< Calc > const product( int_type lNumer,
+                                                      int_type lDenom,
+                                                      int_type rNumer,
+                                                      int_type rDenom,
+                                                      bool const positive )
+        {
+            // Check for zero numerators
+
+            if( lNumer == 0 || rNumer == 0 )
             {
-                return false;
+                return fract< Calc >( 0, true );
             }
-            
-            lNumer *= mul;
-            lDenom *= mul;
-            
-            // Check RHS numerator can be multiplied
-            
-            int_type rNumer = rhs.getNumerator();
-            
-            mul = lcm / rDenom;
-            
-            if( !( isMultiplicationSafe( mul, rNumer ) ) )
+
+            // Cancel common factors across the operands
+
+            int_type const lCommon = gcd( lNumer, rDenom );
+            int_type const rCommon = gcd( rNumer, lDenom );
+
+            lNumer /= lCommon;
+            rDenom /= lCommon;
+            rNumer /= rCommon;
+            lDenom /= rCommon;
+
+            // Multiply if the products fit and the denominator fits the
+            // storage
+
+            int_type numer = 0;
+            int_type denom = 0;
+
+            if( !OverflowCheck::mulOverflows( lNumer, rNumer, numer ) &&
+                !OverflowCheck::mulOverflows( lDenom, rDenom, denom ) &&
+                denom <= fract< Calc >::storage_type::maxDenominator() )
             {
-                return false;
+                return fract< Calc >::fromReduced( numer, denom, positive );
             }
-            
-            rNumer *= mul;
-            
-            // Set fraction components and return true to indicate success
-            
-            lhs.setNumerator( lNumer );
-            lhs.setDenominator( lDenom );
 
-            rhs.setNumerator( rNumer );
-            rhs.setDenominator( lDenom );
-            
-            return true;
+            // Multiply floating-point conversions of reduced components
+
+            float_type const result =
+                ( ( float_type )lNumer / ( float_type )lDenom ) *
+                ( ( float_type )rNumer / ( float_type )rDenom );
+
+            return fract< Calc >( positive ? result : -result );
         }
-            
+
         // TO FLOATING POINT --------------------------------------------------
         
         template< class Calc >
@@ -502,40 +392,7 @@ namespace fract
                           ( ( float_type )x.getDenominator() ) );
             }
         }
-        
-        // IS ADDITION SAFE ---------------------------------------------------
-        
-        static bool const isAdditionSafe( int_type const lhs,
-                                          int_type const rhs )
-        {
-            return ( rhs < ( intMax - lhs ) );
-        }
-        
-        // IS MULTIPLICATION SAFE ---------------------------------------------
-        
-        static bool const isMultiplicationSafe( int_type const lhs,
-                                                int_type const rhs )
-        {
-            if( lhs != 0 )
-            {
-                return ( rhs < ( intMax / lhs ) );
-            }
-            
-            return true;
-        }
 
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-        // MAXIMUM INTEGER VALUE ----------------------------------------------
-        
-        static int_type const intMax;
-
-        // EPSILON ------------------------------------------------------------
-
-        static float_type const EPSILON;
-        
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     };
     
@@ -545,44 +402,42 @@ namespace fract
     
     // PI ---------------------------------------------------------------------
     
-    fract< CheckedSafeFractCalculator > const
-    CheckedSafeFractCalculator::PI = 
-    fract< CheckedSafeFractCalculator >( 2646693125139304345,
-                                         842468587426513207,
-                                         true );
+    template< class OverflowCheck >
+    constexpr fract< BasicCheckedSafeFractCalculator< OverflowCheck > > const
+    BasicCheckedSafeFractCalculator< OverflowCheck >::PI = 
+    fract< BasicCheckedSafeFractCalculator< OverflowCheck > >
+    (
+        2646693125139304345, 842468587426513207, true
+    );
     
-    fract< CheckedSafeFractCalculator > const
-    CheckedSafeFractCalculator::TWO_PI =
-    CheckedSafeFractCalculator::PI *
-    fract< CheckedSafeFractCalculator >( 2, true );
+    template< class OverflowCheck >
+    constexpr fract< BasicCheckedSafeFractCalculator< OverflowCheck > > const
+    BasicCheckedSafeFractCalculator< OverflowCheck >::TWO_PI =
+    BasicCheckedSafeFractCalculator< OverflowCheck >::PI *
+    fract< BasicCheckedSafeFractCalculator< OverflowCheck > >( 2, true );
     
-    fract< CheckedSafeFractCalculator > const
-    CheckedSafeFractCalculator::HALF_PI = 
-    CheckedSafeFractCalculator::PI /
-    fract< CheckedSafeFractCalculator >( 2, true );
+    template< class OverflowCheck >
+    constexpr fract< BasicCheckedSafeFractCalculator< OverflowCheck > > const
+    BasicCheckedSafeFractCalculator< OverflowCheck >::HALF_PI = 
+    BasicCheckedSafeFractCalculator< OverflowCheck >::PI /
+    fract< BasicCheckedSafeFractCalculator< OverflowCheck > >( 2, true );
     
     // EULER'S CONSTANT -------------------------------------------------------
     
-    fract< CheckedSafeFractCalculator > const
-    CheckedSafeFractCalculator::E = 
-    fract< CheckedSafeFractCalculator >( 685, 252, true );
+    template< class OverflowCheck >
+    constexpr fract< BasicCheckedSafeFractCalculator< OverflowCheck > > const
+    BasicCheckedSafeFractCalculator< OverflowCheck >::E = 
+    fract< BasicCheckedSafeFractCalculator< OverflowCheck > >
+    (
+        685, 252, true
+    );
 
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // PRIVATE STATIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // CHECKED SAFE FRACT CALCULATOR TYPE +++++++++++++++++++++++++++++++++++++
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
-    // MAXIMUM INTEGER VALUE --------------------------------------------------
+    typedef BasicCheckedSafeFractCalculator<> CheckedSafeFractCalculator;
 
-    CheckedSafeFractCalculator::int_type const
-    CheckedSafeFractCalculator::intMax =
-    std::numeric_limits< int_type >::max();
-
-    // EPSILON ----------------------------------------------------------------
-
-    CheckedSafeFractCalculator::float_type const
-    CheckedSafeFractCalculator::EPSILON =
-    std::numeric_limits< float_type >::epsilon();
-    
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 }
 
@@ -0,0 +1,423 @@
+#ifndef CORDIC_TRIG_H
+#define CORDIC_TRIG_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <limits>
+
+#include "WideIntegerTraits.h"
+#include "RangeReduction.h"
+#include "GcdEngine.h"
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // CORDIC TRIG CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  A trig backend with the interface of [TrigBackend] that rotates a
+     *  fixed-point vector by the angle, folded into [ 0, HALF_PI / 2 ],
+     *  with CORDIC. The angle table holds atan( 2^-i ) as multiples of
+     *  2^-62, so each step is shifts and adds on 64-bit integers.
+     *
+     *  Results are multiples of 2^-62, or of the smallest power of two
+     *  whose reciprocal the storage can hold, so they are reduced by
+     *  counting trailing zeros rather than with a GCD. Past the range
+     *  reduction their error is within about 2^-58, or half the last bit
+     *  of narrower components, which suits repeated rotations better than
+     *  series whose denominators grow. Select it per call, as
+     *  CordicTrig::sin( x ), or through [TrigTraits], which also covers
+     *  the evaluation of [SineSymbol], [CosineSymbol] and [SinCosSymbol].
+     */
+
+    class CordicTrig
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        static unsigned const fractionBits = 62;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // SINE ---------------------------------------------------------------
+
+        template< class Calculator >
+        static fract< Calculator > const sin( fract< Calculator > const & x )
+        {
+            fract< Calculator > sine;
+            fract< Calculator > cosine;
+
+            sincos( x, sine, cosine );
+
+            return sine;
+        }
+
+        // COSINE -------------------------------------------------------------
+
+        template< class Calculator >
+        static fract< Calculator > const cos( fract< Calculator > const & x )
+        {
+            fract< Calculator > sine;
+            fract< Calculator > cosine;
+
+            sincos( x, sine, cosine );
+
+            return cosine;
+        }
+
+        // SINE AND COSINE ----------------------------------------------------
+
+        /*  Both values come out of the same rotation, so this costs no more
+         *  than either alone.
+         */
+
+        template< class Calculator >
+        static void sincos( fract< Calculator > const & x,
+                            fract< Calculator > & sine,
+                            fract< Calculator > & cosine )
+        {
+            // Only calculators with an invalid state produce a zero
+            // denominator, which the conversion to fixed point divides by
+
+            if( x.getDenominator() == 0 )
+            {
+                sine = x;
+                cosine = x;
+
+                return;
+            }
+
+            bool swapped = false;
+
+            fract< Calculator > const nx = reduce( x, swapped );
+
+            fixed_type fixedSine = 0;
+            fixed_type fixedCosine = 0;
+
+            rotate( toFixed( nx ), fixedSine, fixedCosine );
+
+            sine = fromFixed< Calculator >( fixedSine );
+            cosine = fromFixed< Calculator >( fixedCosine );
+
+            if( swapped )
+            {
+                std::swap( sine, cosine );
+            }
+        }
+
+        // TANGENT ------------------------------------------------------------
+
+        template< class Calculator >
+        static fract< Calculator > const tan( fract< Calculator > const & x )
+        {
+            fract< Calculator > sine;
+            fract< Calculator > cosine;
+
+            sincos( x, sine, cosine );
+
+            return sine / cosine;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef std::int64_t fixed_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        /*  The product of 1 / sqrt( 1 + 2^-2i ) over every step, which
+         *  cancels the growth of the vector when used as its start.
+         */
+
+        static fixed_type const GAIN = 2800459870029452954;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ANGLE --------------------------------------------------------------
+
+        static fixed_type const angle( unsigned const step )
+        {
+            static std::uint64_t const angles[ fractionBits ] =
+            {
+                3622009729038561421u,
+                2138197195906305897u,
+                1129764675555192497u,
+                573486189672913778u,
+                287855953345232185u,
+                144068303048368715u,
+                72051730834756822u,
+                36028064038054493u,
+                18014306884351854u,
+                9007187801521084u,
+                4503598195715550u,
+                2251799634728303u,
+                1125899884473003u,
+                562949950625109u,
+                281474976361131u,
+                140737488311637u,
+                70368744172203u,
+                35184372088149u,
+                17592186044331u,
+                8796093022197u,
+                4398046511103u,
+                2199023255552u,
+                1099511627776u,
+                549755813888u,
+                274877906944u,
+                137438953472u,
+                68719476736u,
+                34359738368u,
+                17179869184u,
+                8589934592u,
+                4294967296u,
+                2147483648u,
+                1073741824u,
+                536870912u,
+                268435456u,
+                134217728u,
+                67108864u,
+                33554432u,
+                16777216u,
+                8388608u,
+                4194304u,
+                2097152u,
+                1048576u,
+                524288u,
+                262144u,
+                131072u,
+                65536u,
+                32768u,
+                16384u,
+                8192u,
+                4096u,
+                2048u,
+                1024u,
+                512u,
+                256u,
+                128u,
+                64u,
+                32u,
+                16u,
+                8u,
+                4u,
+                2u
+            };
+
+            return fixed_type( angles[ step ] );
+        }
+
+        // REDUCE -------------------------------------------------------------
+
+        /*  As [TrigBackend::reduce] with octants folded.
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const reduce
+        (
+            fract< Calculator > const & x,
+            bool & swapped
+        )
+        {
+            unsigned octant = 0;
+
+            fract< Calculator > const nx =
+                RangeReduction< Calculator >::reduceOctant( x, octant );
+
+            swapped = ( ( octant ^ ( octant >> 1 ) ) & 1 ) != 0;
+
+            return nx;
+        }
+
+        // ROTATE -------------------------------------------------------------
+
+        /*  Rotates ( 1, 0 ) by [angle], scaled by 2^62. Steps shift signed
+         *  values right, which rounds towards negative infinity.
+         */
+
+        static void rotate( fixed_type angle,
+                            fixed_type & sine,
+                            fixed_type & cosine )
+        {
+            fixed_type x = GAIN;
+            fixed_type y = 0;
+
+            for( unsigned i = 0; i < fractionBits; i += 1 )
+            {
+                fixed_type const dx = y >> i;
+                fixed_type const dy = x >> i;
+
+                if( angle >= 0 )
+                {
+                    x -= dx;
+                    y += dy;
+                    angle -= CordicTrig::angle( i );
+                }
+                else
+                {
+                    x += dx;
+                    y -= dy;
+                    angle += CordicTrig::angle( i );
+                }
+            }
+
+            sine = y;
+            cosine = x;
+        }
+
+        // TO FIXED -----------------------------------------------------------
+
+        /*  Returns [x], which must lie in [ 0, 1 ), scaled by 2^62 and
+         *  rounded down.
+         */
+
+        template< class Calculator >
+        static fixed_type const toFixed( fract< Calculator > const & x )
+        {
+            typedef typename fract< Calculator >::int_type int_type;
+
+            DEBUG_CODE( assert( x.getNumerator() < x.getDenominator() ) );
+
+            return toFixed
+            (
+                x,
+                std::integral_constant
+                <
+                    bool,
+                    std::is_integral< int_type >::value &&
+                    sizeof( int_type ) <= 8 &&
+                    UnsignedOfSize< 16 >::exists
+                >()
+            );
+        }
+
+        template< class Calculator >
+        static fixed_type const toFixed( fract< Calculator > const & x,
+                                         std::true_type )
+        {
+            typedef typename UnsignedOfSize< 16 >::type wide_type;
+
+            wide_type const numer = wide_type( x.getNumerator() );
+            wide_type const denom = wide_type( x.getDenominator() );
+
+            return fixed_type( ( numer << fractionBits ) / denom );
+        }
+
+        template< class Calculator >
+        static fixed_type const toFixed( fract< Calculator > const & x,
+                                         std::false_type )
+        {
+            typedef typename fract< Calculator >::int_type int_type;
+
+            int_type const one( std::uint64_t( 1 ) << fractionBits );
+
+            return fixed_type
+            (
+                std::uint64_t( x.getNumerator() * one / x.getDenominator() )
+            );
+        }
+
+        // FROM FIXED ---------------------------------------------------------
+
+        /*  Returns [value] / 2^62 as a fraction of [Calculator], clamped to
+         *  [ 0, 1 ] and rounded to the nearest power of two denominator the
+         *  storage can hold.
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const fromFixed( fixed_type const value )
+        {
+            typedef fract< Calculator > fract_type;
+            typedef typename fract_type::int_type int_type;
+            typedef typename fract_type::storage_type storage_type;
+
+            std::uint64_t const one = std::uint64_t( 1 ) << fractionBits;
+
+            if( value <= 0 )
+            {
+                return fract_type( 0, true );
+            }
+
+            std::uint64_t numer = std::min( std::uint64_t( value ), one );
+            unsigned scale = fractionBits;
+
+            // Drop bits below the storage's smallest power of two
+
+            if( std::numeric_limits< int_type >::is_bounded )
+            {
+                std::uint64_t const limit =
+                    std::uint64_t( storage_type::maxDenominator() );
+
+                while( ( std::uint64_t( 1 ) << scale ) > limit )
+                {
+                    scale -= 1;
+                }
+
+                unsigned const dropped = fractionBits - scale;
+
+                if( dropped > 0 )
+                {
+                    numer += std::uint64_t( 1 ) << ( dropped - 1 );
+                    numer >>= dropped;
+                }
+            }
+
+            if( numer == 0 )
+            {
+                return fract_type( 0, true );
+            }
+
+            // Reduce by shifting out common factors of two
+
+            unsigned const zeros = std::min( countTrailingZeros( numer ),
+                                             scale );
+
+            return fract_type::fromReduced
+            (
+                int_type( numer >> zeros ),
+                int_type( std::uint64_t( 1 ) << ( scale - zeros ) ),
+                true
+            );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // CORDIC_TRIG_H
@@ -0,0 +1,123 @@
+#ifndef ERROR_POLICY_H
+#define ERROR_POLICY_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "UnsafeOperationException.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // THROWING ERROR POLICY CLASS ++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Decides what an exact calculator does with a result it cannot
+     *  represent. [fail] is called in place of the result and either leaves
+     *  the operation or returns a value to stand in for it.
+     *
+     *  This policy throws [UnsafeOperationException].
+     */
+
+    class ThrowingErrorPolicy
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // FAIL ---------------------------------------------------------------
+
+        template< class Calculator >
+        static fract< Calculator > const fail( void )
+        {
+            throw UnsafeOperationException();
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // STICKY FLAG ERROR POLICY CLASS +++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Returns zero for a failed operation and raises a flag that stays
+     *  raised until [clear] is called. Nothing unwinds, so a batch of
+     *  operations can run without branches out of the loop and be checked
+     *  once with [hasFailed] at the end.
+     *
+     *  The flag is per thread and shared by every calculator using this
+     *  policy, so threads can check their own batches independently.
+     */
+
+    class StickyFlagErrorPolicy
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // FAIL ---------------------------------------------------------------
+
+        template< class Calculator >
+        static fract< Calculator > const fail( void )
+        {
+            flag() = true;
+
+            return fract< Calculator >( 0, true );
+        }
+
+        // HAS FAILED ---------------------------------------------------------
+
+        static bool const hasFailed( void )
+        {
+            return flag();
+        }
+
+        // CLEAR --------------------------------------------------------------
+
+        static void clear( void )
+        {
+            flag() = false;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // FLAG ---------------------------------------------------------------
+
+        static bool & flag( void )
+        {
+            static thread_local bool failed = false;
+
+            return failed;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // ERROR_POLICY_H
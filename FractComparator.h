@@ -0,0 +1,223 @@
+#ifndef FRACT_COMPARATOR_H
+#define FRACT_COMPARATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cassert>
+
+#include "WideIntegerTraits.h"
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FRACT COMPARATOR CLASS +++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Exact, overflow-free comparison of two fractions shared by the
+     *  calculators. Magnitudes a/b and c/d are compared as a*d against c*b
+     *  in the wide type from [WideIntegerTraits]. Integer types without a
+     *  wide type are compared by expanding both fractions as continued
+     *  fractions until a term differs, which needs no products at all.
+     */
+
+    class FractComparator
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // COMPARE ------------------------------------------------------------
+
+        /*  Returns a negative value, zero or a positive value as [lhs] is
+         *  less than, equal to or greater than [rhs].
+         */
+
+        template< class Calc1, class Calc2 >
+        static constexpr int const compare( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            typedef typename std::common_type
+            <
+                typename fract< Calc1 >::int_type,
+                typename fract< Calc2 >::int_type
+            >
+            ::type int_type;
+
+            // Compare signs, treating zero as neither sign
+
+            int const lSign = lhs.isZero() ? 0 : ( lhs.isPositive() ? 1 : -1 );
+            int const rSign = rhs.isZero() ? 0 : ( rhs.isPositive() ? 1 : -1 );
+
+            if( lSign != rSign )
+            {
+                return ( lSign < rSign ) ? -1 : 1;
+            }
+
+            if( lSign == 0 )
+            {
+                return 0;
+            }
+
+            // Compare magnitudes, reversing the order for negative values.
+            // Components already of the common type are not copied
+
+            int_type const & lNumer = lhs.getNumerator();
+            int_type const & lDenom = lhs.getDenominator();
+            int_type const & rNumer = rhs.getNumerator();
+            int_type const & rDenom = rhs.getDenominator();
+
+            return lSign * compareMagnitudes( lNumer, lDenom, rNumer, rDenom );
+        }
+
+        // COMPARE MAGNITUDES -------------------------------------------------
+
+        /*  Compares the non-negative fractions [lNumer]/[lDenom] and
+         *  [rNumer]/[rDenom]. Denominators must be non-zero.
+         */
+
+        template< class IntType >
+        static constexpr int const compareMagnitudes( IntType const & lNumer,
+                                                      IntType const & lDenom,
+                                                      IntType const & rNumer,
+                                                      IntType const & rDenom )
+        {
+            DEBUG_CODE( assert( lDenom > 0 && rDenom > 0 ) );
+
+            // Equal denominators only need the numerators compared
+
+            if( lDenom == rDenom )
+            {
+                return order( lNumer, rNumer );
+            }
+
+            // Select strategy by availability of a wide type
+
+            return compareMagnitudes
+            (
+                lNumer, lDenom, rNumer, rDenom,
+                std::integral_constant
+                <
+                    bool,
+                    WideIntegerTraits< IntType >::hasWideType
+                >()
+            );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ORDER --------------------------------------------------------------
+
+        template< class IntType >
+        static constexpr int const order( IntType const & lhs,
+                                          IntType const & rhs )
+        {
+            return ( lhs < rhs ) ? -1 : ( ( rhs < lhs ) ? 1 : 0 );
+        }
+
+        // COMPARE MAGNITUDES (CROSS-MULTIPLICATION) --------------------------
+
+        template< class IntType >
+        static constexpr int const compareMagnitudes( IntType const & lNumer,
+                                                      IntType const & lDenom,
+                                                      IntType const & rNumer,
+                                                      IntType const & rDenom,
+                                                      std::true_type )
+        {
+            typedef typename WideIntegerTraits< IntType >::wide_type
+                wide_type;
+
+            // A proper fraction is less than an improper one, which settles
+            // differing integer parts in the common case without a product
+
+            bool const lProper = lNumer < lDenom;
+            bool const rProper = rNumer < rDenom;
+
+            if( lProper != rProper )
+            {
+                return lProper ? -1 : 1;
+            }
+
+            // Compare cross products
+
+            return order( wide_type( lNumer ) * wide_type( rDenom ),
+                          wide_type( rNumer ) * wide_type( lDenom ) );
+        }
+
+        // COMPARE MAGNITUDES (CONTINUED FRACTION) ----------------------------
+
+        template< class IntType >
+        static constexpr int const compareMagnitudes( IntType lNumer,
+                                                      IntType lDenom,
+                                                      IntType rNumer,
+                                                      IntType rDenom,
+                                                      std::false_type )
+        {
+            // Each pass compares integer parts; equal parts leave the
+            // remainders to compare, which is done on their reciprocals
+            // with the order reversed
+
+            int direction = 1;
+
+            for( ;; )
+            {
+                // Compare integer parts
+
+                IntType const lWhole = lNumer / lDenom;
+                IntType const rWhole = rNumer / rDenom;
+
+                if( lWhole != rWhole )
+                {
+                    return direction * order( lWhole, rWhole );
+                }
+
+                // Compare remainders
+
+                IntType const lRem = lNumer - lWhole * lDenom;
+                IntType const rRem = rNumer - rWhole * rDenom;
+
+                if( lRem == 0 || rRem == 0 )
+                {
+                    return direction * order( lRem, rRem );
+                }
+
+                lNumer = lDenom;
+                lDenom = lRem;
+                rNumer = rDenom;
+                rDenom = rRem;
+
+                direction = -direction;
+            }
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // FRACT_COMPARATOR_H
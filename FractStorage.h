@@ -0,0 +1,306 @@
+#ifndef FRACT_STORAGE_H
+#define FRACT_STORAGE_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cstdint>
+#include <utility>
+#include <limits>
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FRACT STORAGE CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Default layout for the components of a fraction. Both magnitudes are
+     *  held at full width alongside a separate sign flag, so any integer
+     *  type can be stored. With 64-bit components this takes 24 bytes, 7 of
+     *  which are padding.
+     */
+
+    template< class IntType >
+    class FractStorage
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+        typedef int_type const & denominator_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        constexpr FractStorage( int_type numerator,
+                                int_type denominator,
+                                bool positive ):
+        numer( std::move( numerator ) ),
+        denom( std::move( denominator ) ),
+        positive( positive )
+        {}
+
+        // GET NUMERATOR ------------------------------------------------------
+
+        constexpr int_type const & getNumerator( void ) const
+        {
+            return this->numer;
+        }
+
+        // SET NUMERATOR ------------------------------------------------------
+
+        constexpr void setNumerator( int_type numerator )
+        {
+            this->numer = std::move( numerator );
+        }
+
+        // GET DENOMINATOR ----------------------------------------------------
+
+        constexpr denominator_type getDenominator( void ) const
+        {
+            return this->denom;
+        }
+
+        // SET DENOMINATOR ----------------------------------------------------
+
+        constexpr void setDenominator( int_type denominator )
+        {
+            this->denom = std::move( denominator );
+        }
+
+        // IS POSITIVE --------------------------------------------------------
+
+        constexpr bool const isPositive( void ) const
+        {
+            return this->positive;
+        }
+
+        // SET POSITIVE -------------------------------------------------------
+
+        constexpr void setPositive( bool positive )
+        {
+            this->positive = positive;
+        }
+
+        // MAX DENOMINATOR ----------------------------------------------------
+
+        static constexpr int_type const maxDenominator( void )
+        {
+            return std::numeric_limits< int_type >::max();
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        int_type numer;
+        int_type denom;
+
+        bool positive;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PACKED FRACT STORAGE CLASS +++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Folds the sign into the top bit of the denominator word, so two
+     *  64-bit components take 16 bytes with no padding. Denominators are
+     *  limited to one bit less than [IntType], see [maxDenominator], and
+     *  calculators must keep results within it: storing a larger value
+     *  drops its top bit, which turns 2^63 into an invalid zero. The
+     *  denominator is returned by value.
+     */
+
+    template< class IntType >
+    class PackedFractStorage
+    {
+        static_assert( std::is_integral< IntType >::value &&
+                       std::is_unsigned< IntType >::value,
+                       "packed storage needs a builtin unsigned type" );
+
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+        typedef int_type const denominator_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        constexpr PackedFractStorage( int_type numerator,
+                                      int_type denominator,
+                                      bool positive ):
+        numer( numerator ),
+        signAndDenom( pack( denominator, positive ) )
+        {}
+
+        // GET NUMERATOR ------------------------------------------------------
+
+        constexpr int_type const & getNumerator( void ) const
+        {
+            return this->numer;
+        }
+
+        // SET NUMERATOR ------------------------------------------------------
+
+        constexpr void setNumerator( int_type numerator )
+        {
+            this->numer = numerator;
+        }
+
+        // GET DENOMINATOR ----------------------------------------------------
+
+        constexpr denominator_type getDenominator( void ) const
+        {
+            return this->signAndDenom & maxDenominator();
+        }
+
+        // SET DENOMINATOR ----------------------------------------------------
+
+        constexpr void setDenominator( int_type denominator )
+        {
+            this->signAndDenom = pack( denominator, this->isPositive() );
+        }
+
+        // IS POSITIVE --------------------------------------------------------
+
+        constexpr bool const isPositive( void ) const
+        {
+            return ( this->signAndDenom & signBit() ) == 0;
+        }
+
+        // SET POSITIVE -------------------------------------------------------
+
+        constexpr void setPositive( bool positive )
+        {
+            this->signAndDenom = pack( this->getDenominator(), positive );
+        }
+
+        // MAX DENOMINATOR ----------------------------------------------------
+
+        static constexpr int_type const maxDenominator( void )
+        {
+            return std::numeric_limits< int_type >::max() >> 1;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // SIGN BIT -----------------------------------------------------------
+
+        static constexpr int_type const signBit( void )
+        {
+            return ~maxDenominator();
+        }
+
+        // PACK ---------------------------------------------------------------
+
+        static constexpr int_type const pack( int_type const denominator,
+                                              bool const positive )
+        {
+            return ( denominator & maxDenominator() ) |
+                   ( positive ? int_type( 0 ) : signBit() );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        int_type numer;
+        int_type signAndDenom;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BOUNDED FRACT STORAGE CLASS ++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  The default layout with [maxDenominator] lowered to [MaxDenominator].
+     *  Anything that fits results to the storage, such as range reduction
+     *  and floating-point conversion, then keeps to the bound as well. See
+     *  [BoundedFractCalculator.h].
+     */
+
+    template< class IntType, std::uint64_t MaxDenominator >
+    class BoundedFractStorage : public FractStorage< IntType >
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        using FractStorage< IntType >::FractStorage;
+
+        // MAX DENOMINATOR ----------------------------------------------------
+
+        static constexpr int_type const maxDenominator( void )
+        {
+            return int_type( MaxDenominator );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FRACT STORAGE TRAITS CLASS +++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Selects the storage layout used by [fract< Calculator >]. Calculators
+     *  get the default layout; a calculator may specialise this class to
+     *  name another, which must provide the same members as [FractStorage].
+     *  See [PackedFractCalculator.h].
+     */
+
+    template< class Calculator >
+    class FractStorageTraits
+    {
+        public:
+
+        typedef FractStorage< typename Calculator::int_type > storage_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // FRACT_STORAGE_H
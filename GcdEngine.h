@@ -0,0 +1,308 @@
+#ifndef GCD_ENGINE_H
+#define GCD_ENGINE_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cassert>
+#include <limits>
+
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FUNCTIONS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // COUNT TRAILING ZEROS ---------------------------------------------------
+
+    /*  Returns the number of trailing zero bits in a non-zero integer. The
+     *  compiler builtins map onto a single instruction (BSF/TZCNT) where the
+     *  target supports it; the loops are a portable fallback. All overloads
+     *  are usable in constant expressions.
+     */
+
+    constexpr unsigned const countTrailingZeros( unsigned int x )
+    {
+        DEBUG_CODE( assert( x != 0 ) );
+
+        #if defined( __GNUC__ )
+            return __builtin_ctz( x );
+        #else
+            unsigned count = 0;
+
+            while( ( x & 1u ) == 0 )
+            {
+                x >>= 1;
+                count += 1;
+            }
+
+            return count;
+        #endif
+    }
+
+    constexpr unsigned const countTrailingZeros( unsigned long x )
+    {
+        DEBUG_CODE( assert( x != 0 ) );
+
+        #if defined( __GNUC__ )
+            return __builtin_ctzl( x );
+        #else
+            unsigned count = 0;
+
+            while( ( x & 1ul ) == 0 )
+            {
+                x >>= 1;
+                count += 1;
+            }
+
+            return count;
+        #endif
+    }
+
+    constexpr unsigned const countTrailingZeros( unsigned long long x )
+    {
+        DEBUG_CODE( assert( x != 0 ) );
+
+        #if defined( __GNUC__ )
+            return __builtin_ctzll( x );
+        #else
+            unsigned count = 0;
+
+            while( ( x & 1ull ) == 0 )
+            {
+                x >>= 1;
+                count += 1;
+            }
+
+            return count;
+        #endif
+    }
+
+    constexpr unsigned const countTrailingZeros( unsigned short x )
+    {
+        return countTrailingZeros( ( unsigned int )x );
+    }
+
+    constexpr unsigned const countTrailingZeros( unsigned char x )
+    {
+        return countTrailingZeros( ( unsigned int )x );
+    }
+
+    #if defined( __SIZEOF_INT128__ )
+
+    constexpr unsigned const countTrailingZeros( unsigned __int128 x )
+    {
+        DEBUG_CODE( assert( x != 0 ) );
+
+        unsigned long long const low = ( unsigned long long )x;
+
+        if( low != 0 )
+        {
+            return countTrailingZeros( low );
+        }
+
+        return 64 + countTrailingZeros( ( unsigned long long )( x >> 64 ) );
+    }
+
+    #endif
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // EUCLIDEAN GCD CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Classic remainder based Euclidean algorithm. It only needs [%] and
+     *  [==] from the integer type, so it is used for any type without a
+     *  more specific engine.
+     */
+
+    template< class IntType >
+    class EuclideanGcd
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GCD ----------------------------------------------------------------
+
+        static constexpr IntType const gcd( IntType a, IntType b )
+        {
+            for( ;; )
+            {
+                if( a == 0 )
+                {
+                    return b;
+                }
+
+                b %= a;
+
+                if( b == 0 )
+                {
+                    return a;
+                }
+
+                a %= b;
+            }
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BINARY GCD CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Stein's binary GCD algorithm. Common factors of two are removed with
+     *  a single count-trailing-zeros and shift, after which only subtraction
+     *  and shifting are needed. A single remainder is taken up front when
+     *  the operands differ by more than 16 bits, otherwise no hardware
+     *  division is performed.
+     */
+
+    template< class IntType >
+    class BinaryGcd
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GCD ----------------------------------------------------------------
+
+        static constexpr IntType const gcd( IntType a, IntType b )
+        {
+            // Check for zero operands
+
+            if( a == 0 )
+            {
+                return b;
+            }
+
+            if( b == 0 )
+            {
+                return a;
+            }
+
+            // Operands of very different magnitude would need one
+            // subtraction step per bit of difference, so close the gap with
+            // a single remainder first
+
+            if( ( a >> 16 ) > b )
+            {
+                a %= b;
+
+                if( a == 0 )
+                {
+                    return b;
+                }
+            }
+            else if( ( b >> 16 ) > a )
+            {
+                b %= a;
+
+                if( b == 0 )
+                {
+                    return a;
+                }
+            }
+
+            // Find power of two common to both operands
+
+            unsigned const shift = countTrailingZeros( IntType( a | b ) );
+
+            b >>= countTrailingZeros( b );
+
+            // Setting the top bit leaves a trailing zero count unchanged for
+            // non-zero values and keeps it defined for zero
+
+            IntType const topBit = IntType
+            (
+                IntType( 1 ) << ( std::numeric_limits< IntType >::digits - 1 )
+            );
+
+            // Replace the larger operand by the difference until it vanishes.
+            // Both selections compile to conditional moves, and the trailing
+            // zero count of the difference overlaps with them.
+
+            unsigned zeros = countTrailingZeros( a );
+
+            do
+            {
+                a >>= zeros;
+
+                IntType const diff = IntType( ( a > b ) ? a - b : b - a );
+
+                b = ( a < b ) ? a : b;
+                a = diff;
+
+                zeros = countTrailingZeros( IntType( a | topBit ) );
+            }
+            while( a != 0 );
+
+            // Restore common power of two
+
+            return IntType( b << shift );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // GCD ENGINE CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Selects the GCD algorithm used for an integer type. Builtin unsigned
+     *  types of up to 32 bits use the binary engine. Wider types keep
+     *  Euclid, whose hardware division takes fewer steps than binary
+     *  subtraction on the large operands the wide calculators produce, see
+     *  the gcd test in [main.cpp]. Integer types defined elsewhere may
+     *  specialise this class to supply their own engine.
+     */
+
+    template< class IntType >
+    class GcdEngine : public EuclideanGcd< IntType >
+    {
+    };
+
+    template<>
+    class GcdEngine< unsigned char > : public BinaryGcd< unsigned char >
+    {
+    };
+
+    template<>
+    class GcdEngine< unsigned short > : public BinaryGcd< unsigned short >
+    {
+    };
+
+    template<>
+    class GcdEngine< unsigned int > : public BinaryGcd< unsigned int >
+    {
+    };
+
+    template<>
+    class GcdEngine< unsigned long > :
+        public std::conditional
+        <
+            sizeof( unsigned long ) <= 4,
+            BinaryGcd< unsigned long >,
+            EuclideanGcd< unsigned long >
+        >::type
+    {
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // GCD_ENGINE_H
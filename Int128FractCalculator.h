@@ -0,0 +1,37 @@
+#ifndef INT128_FRACT_CALCULATOR_H
+#define INT128_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+
+#include "WideFractCalculator.h"
+
+#if defined( __SIZEOF_INT128__ )
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // INT128 FRACT CALCULATOR ++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Exact arithmetic on 64-bit components with 128-bit intermediates,
+     *  see [BasicWideFractCalculator].
+     */
+
+    typedef BasicWideFractCalculator< std::uint64_t > Int128FractCalculator;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+#endif // __SIZEOF_INT128__
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // INT128_FRACT_CALCULATOR_H
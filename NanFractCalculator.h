@@ -0,0 +1,273 @@
+#ifndef NAN_FRACT_CALCULATOR_H
+#define NAN_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+
+#include "WideFractCalculator.h"
+#include "FractComparator.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BASIC NAN FRACT CALCULATOR CLASS +++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Performs exact arithmetic as [BasicWideFractCalculator] does, but a
+     *  result that cannot be represented becomes the invalid fraction 0/0
+     *  instead of throwing. Any operation with an invalid operand gives an
+     *  invalid result, so a long computation can be checked once at the
+     *  end with [isInvalid]. Invalid fractions convert to NaN, print as
+     *  "nan" and compare unequal to everything, themselves included.
+     *
+     *  Range reduction passes an invalid angle through, so the trig
+     *  functions give an invalid result for it, as does [limitDenominator].
+     *  An invalid fraction has a zero numerator, so [isZero] is true for
+     *  it; check [isInvalid] first.
+     */
+
+    template< class IntType >
+    class BasicNanFractCalculator
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( areValid( lhs, rhs ) &&
+                exact_type::tryAdd( lhs, rhs, result ) )
+            {
+                return result;
+            }
+
+            return invalid< Calc1 >();
+        }
+
+        // MUL ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( areValid( lhs, rhs ) &&
+                exact_type::tryMul( lhs, rhs, result ) )
+            {
+                return result;
+            }
+
+            return invalid< Calc1 >();
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( areValid( lhs, rhs ) &&
+                exact_type::tryDiv( lhs, rhs, result ) )
+            {
+                return result;
+            }
+
+            return invalid< Calc1 >();
+        }
+
+        // ARE EQUAL ----------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
+        {
+            return areValid( lhs, rhs ) &&
+                   FractComparator::compare( lhs, rhs ) == 0;
+        }
+
+        // IS LESS ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            return areValid( lhs, rhs ) &&
+                   FractComparator::compare( lhs, rhs ) < 0;
+        }
+
+        // IS LESS OR EQUAL ---------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            return areValid( lhs, rhs ) &&
+                   FractComparator::compare( lhs, rhs ) <= 0;
+        }
+
+        // IS GREATER ---------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
+        {
+            return areValid( lhs, rhs ) &&
+                   FractComparator::compare( lhs, rhs ) > 0;
+        }
+
+        // IS GREATER OR EQUAL ------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
+        {
+            return areValid( lhs, rhs ) &&
+                   FractComparator::compare( lhs, rhs ) >= 0;
+        }
+
+        // IS INVALID ---------------------------------------------------------
+
+        template< class Calc >
+        static constexpr bool const isInvalid( fract< Calc > const & x )
+        {
+            return x.getDenominator() == 0;
+        }
+
+        // INVALID ------------------------------------------------------------
+
+        template< class Calc >
+        static constexpr fract< Calc > const invalid( void )
+        {
+            return fract< Calc >::fromReduced( 0, 0, true );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PI -----------------------------------------------------------------
+
+        static fract< BasicNanFractCalculator > const PI;
+        static fract< BasicNanFractCalculator > const TWO_PI;
+        static fract< BasicNanFractCalculator > const HALF_PI;
+
+        // EULER'S CONSTANT ---------------------------------------------------
+
+        static fract< BasicNanFractCalculator > const E;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef BasicWideFractCalculator< IntType > exact_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ARE VALID ----------------------------------------------------------
+
+        /*  Tests both denominators without short-circuiting, leaving one
+         *  branch rather than two.
+         */
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const areValid( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
+        {
+            return ( ( lhs.getDenominator() != 0 ) &
+                     ( rhs.getDenominator() != 0 ) ) != 0;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // PI ---------------------------------------------------------------------
+
+    template< class IntType >
+    constexpr fract< BasicNanFractCalculator< IntType > > const
+    BasicNanFractCalculator< IntType >::TWO_PI =
+    BasicNanFractCalculator< IntType >::PI *
+    fract< BasicNanFractCalculator< IntType > >( 2, true );
+
+    template< class IntType >
+    constexpr fract< BasicNanFractCalculator< IntType > > const
+    BasicNanFractCalculator< IntType >::HALF_PI =
+    BasicNanFractCalculator< IntType >::PI /
+    fract< BasicNanFractCalculator< IntType > >( 2, true );
+
+    template< class IntType >
+    constexpr fract< BasicNanFractCalculator< IntType > > const
+    BasicNanFractCalculator< IntType >::PI =
+    fract< BasicNanFractCalculator< IntType > >
+    (
+        WidePi< IntType >::numerator(),
+        WidePi< IntType >::denominator(),
+        true
+    );
+
+    // EULER'S CONSTANT -------------------------------------------------------
+
+    template< class IntType >
+    constexpr fract< BasicNanFractCalculator< IntType > > const
+    BasicNanFractCalculator< IntType >::E =
+    fract< BasicNanFractCalculator< IntType > >( 685, 252, true );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // NAN FRACT CALCULATOR +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    #if defined( __SIZEOF_INT128__ )
+
+    typedef BasicNanFractCalculator< std::uint64_t > NanFractCalculator;
+
+    #endif
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // NAN_FRACT_CALCULATOR_H
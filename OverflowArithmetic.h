@@ -0,0 +1,164 @@
+#ifndef OVERFLOW_ARITHMETIC_H
+#define OVERFLOW_ARITHMETIC_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <limits>
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // DIVISION OVERFLOW CHECK CLASS ++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Portable unsigned arithmetic that reports whether the result
+     *  wrapped, by comparing an operand against the headroom left by the
+     *  other. Checking a multiplication takes a division.
+     */
+
+    class DivisionOverflowCheck
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD OVERFLOWS ------------------------------------------------------
+
+        template< class IntType >
+        static constexpr bool const addOverflows( IntType const lhs,
+                                                  IntType const rhs,
+                                                  IntType & result )
+        {
+            static_assert( std::is_unsigned< IntType >::value,
+                           "overflow checks need a builtin unsigned type" );
+
+            result = lhs + rhs;
+
+            return rhs > std::numeric_limits< IntType >::max() - lhs;
+        }
+
+        // MULTIPLY OVERFLOWS -------------------------------------------------
+
+        template< class IntType >
+        static constexpr bool const mulOverflows( IntType const lhs,
+                                                  IntType const rhs,
+                                                  IntType & result )
+        {
+            static_assert( std::is_unsigned< IntType >::value,
+                           "overflow checks need a builtin unsigned type" );
+
+            result = lhs * rhs;
+
+            return lhs != 0 &&
+                   rhs > std::numeric_limits< IntType >::max() / lhs;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FUNCTIONS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Unsigned arithmetic that reports whether the result wrapped. The
+     *  compiler builtins perform the operation and read the carry or
+     *  overflow flag it leaves, so a checked step costs about as much as an
+     *  unchecked one. Other compilers use [DivisionOverflowCheck].
+     */
+
+    // ADD OVERFLOWS ----------------------------------------------------------
+
+    /*  Sets [result] to [lhs] + [rhs], modulo the range of [IntType], and
+     *  returns true if the sum did not fit.
+     */
+
+    template< class IntType >
+    constexpr bool const addOverflows( IntType const lhs,
+                                       IntType const rhs,
+                                       IntType & result )
+    {
+        static_assert( std::is_unsigned< IntType >::value,
+                       "overflow checks need a builtin unsigned type" );
+
+        #if defined( __GNUC__ )
+            return __builtin_add_overflow( lhs, rhs, &result );
+        #else
+            return DivisionOverflowCheck::addOverflows( lhs, rhs, result );
+        #endif
+    }
+
+    // MULTIPLY OVERFLOWS -----------------------------------------------------
+
+    /*  Sets [result] to [lhs] * [rhs], modulo the range of [IntType], and
+     *  returns true if the product did not fit.
+     */
+
+    template< class IntType >
+    constexpr bool const mulOverflows( IntType const lhs,
+                                       IntType const rhs,
+                                       IntType & result )
+    {
+        static_assert( std::is_unsigned< IntType >::value,
+                       "overflow checks need a builtin unsigned type" );
+
+        #if defined( __GNUC__ )
+            return __builtin_mul_overflow( lhs, rhs, &result );
+        #else
+            return DivisionOverflowCheck::mulOverflows( lhs, rhs, result );
+        #endif
+    }
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BUILTIN OVERFLOW CHECK CLASS +++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Forwards to [addOverflows] and [mulOverflows], for code that takes
+     *  the check as a template parameter.
+     */
+
+    class BuiltinOverflowCheck
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD OVERFLOWS ------------------------------------------------------
+
+        template< class IntType >
+        static constexpr bool const addOverflows( IntType const lhs,
+                                                  IntType const rhs,
+                                                  IntType & result )
+        {
+            return ::fract::addOverflows( lhs, rhs, result );
+        }
+
+        // MULTIPLY OVERFLOWS -------------------------------------------------
+
+        template< class IntType >
+        static constexpr bool const mulOverflows( IntType const lhs,
+                                                  IntType const rhs,
+                                                  IntType & result )
+        {
+            return ::fract::mulOverflows( lhs, rhs, result );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // OVERFLOW_ARITHMETIC_H
@@ -0,0 +1,116 @@
+#ifndef PACKED_FRACT_CALCULATOR_H
+#define PACKED_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "FractStorage.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PACKED FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Performs arithmetic exactly as [Calculator] does, but selects
+     *  [PackedFractStorage] for its fractions. With 64-bit components a
+     *  fraction takes 16 bytes rather than 24 and is trivially copyable,
+     *  at the cost of one bit of denominator range.
+     *
+     *  [Calculator] must have a builtin unsigned [int_type]. The checked
+     *  calculators test results against the storage's [maxDenominator], so
+     *  they keep their guarantees over the narrower range.
+     */
+
+    template< class Calculator >
+    class PackedFractCalculator : public Calculator
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef typename Calculator::int_type int_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PI -----------------------------------------------------------------
+
+        /*  The constants are those of [Calculator], converted to the packed
+         *  layout.
+         */
+
+        static fract< PackedFractCalculator > const PI;
+        static fract< PackedFractCalculator > const TWO_PI;
+        static fract< PackedFractCalculator > const HALF_PI;
+
+        // EULER'S CONSTANT ---------------------------------------------------
+
+        static fract< PackedFractCalculator > const E;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FRACT STORAGE TRAITS SPECIALISATION ++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class FractStorageTraits< PackedFractCalculator< Calculator > >
+    {
+        public:
+
+        typedef PackedFractStorage< typename Calculator::int_type >
+            storage_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // PI ---------------------------------------------------------------------
+
+    template< class Calc >
+    constexpr fract< PackedFractCalculator< Calc > > const
+    PackedFractCalculator< Calc >::PI =
+    fract< PackedFractCalculator< Calc > >( Calc::PI );
+
+    template< class Calc >
+    constexpr fract< PackedFractCalculator< Calc > > const
+    PackedFractCalculator< Calc >::TWO_PI =
+    fract< PackedFractCalculator< Calc > >( Calc::TWO_PI );
+
+    template< class Calc >
+    constexpr fract< PackedFractCalculator< Calc > > const
+    PackedFractCalculator< Calc >::HALF_PI =
+    fract< PackedFractCalculator< Calc > >( Calc::HALF_PI );
+
+    // EULER'S CONSTANT -------------------------------------------------------
+
+    template< class Calc >
+    constexpr fract< PackedFractCalculator< Calc > > const
+    PackedFractCalculator< Calc >::E =
+    fract< PackedFractCalculator< Calc > >( Calc::E );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // PACKED_FRACT_CALCULATOR_H
@@ -0,0 +1,460 @@
+#ifndef PROMOTING_FRACT_CALCULATOR_H
+#define PROMOTING_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+
+#include "UnsafeFractCalculator.h"
+#include "PromotingUnsigned.h"
+#include "BigFractCalculator.h"
+#include "FractComparator.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PROMOTING FRACT CALCULATOR CLASS +++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Exact calculator that never throws or approximates. Components are
+     *  [PromotingUnsigned], so a fraction keeps the 24-byte layout of a
+     *  64-bit fract while its components fit in 63 bits, and promotes them
+     *  to the heap only when they grow beyond that.
+     *
+     *  When every component is inline the operations below run on machine
+     *  words with 128-bit intermediates, as [Int128FractCalculator] does,
+     *  and never fail; results that do not fit promote. Anything involving
+     *  a promoted component is handed to [BigFractCalculator].
+     */
+
+    class PromotingFractCalculator
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef PromotingUnsigned int_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            int_type const & lNumer = lhs.getNumerator();
+            int_type const & lDenom = lhs.getDenominator();
+            int_type const & rNumer = rhs.getNumerator();
+            int_type const & rDenom = rhs.getDenominator();
+
+            #if defined( __SIZEOF_INT128__ )
+
+            if( lNumer.isInline() && lDenom.isInline() &&
+                rNumer.isInline() && rDenom.isInline() )
+            {
+                return addInline< Calc1 >( lNumer.getInline(),
+                                           lDenom.getInline(),
+                                           lhs.isPositive(),
+                                           rNumer.getInline(),
+                                           rDenom.getInline(),
+                                           rhs.isPositive() );
+            }
+
+            #endif
+
+            return narrow< Calc1 >( BigFractCalculator::add( widen( lhs ),
+                                                             widen( rhs ) ) );
+        }
+
+        // MUL ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            int_type const & lNumer = lhs.getNumerator();
+            int_type const & lDenom = lhs.getDenominator();
+            int_type const & rNumer = rhs.getNumerator();
+            int_type const & rDenom = rhs.getDenominator();
+
+            #if defined( __SIZEOF_INT128__ )
+
+            if( lNumer.isInline() && lDenom.isInline() &&
+                rNumer.isInline() && rDenom.isInline() )
+            {
+                return productInline< Calc1 >
+                (
+                    lNumer.getInline(),
+                    lDenom.getInline(),
+                    rNumer.getInline(),
+                    rDenom.getInline(),
+                    lhs.isPositive() == rhs.isPositive()
+                );
+            }
+
+            #endif
+
+            return narrow< Calc1 >( BigFractCalculator::mul( widen( lhs ),
+                                                             widen( rhs ) ) );
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
+            {
+                return fract< Calc1 >( 0, true );
+            }
+
+            int_type const & lNumer = lhs.getNumerator();
+            int_type const & lDenom = lhs.getDenominator();
+            int_type const & rNumer = rhs.getNumerator();
+            int_type const & rDenom = rhs.getDenominator();
+
+            #if defined( __SIZEOF_INT128__ )
+
+            if( lNumer.isInline() && lDenom.isInline() &&
+                rNumer.isInline() && rDenom.isInline() )
+            {
+                return productInline< Calc1 >
+                (
+                    lNumer.getInline(),
+                    lDenom.getInline(),
+                    rDenom.getInline(),
+                    rNumer.getInline(),
+                    lhs.isPositive() == rhs.isPositive()
+                );
+            }
+
+            #endif
+
+            return narrow< Calc1 >( BigFractCalculator::div( widen( lhs ),
+                                                             widen( rhs ) ) );
+        }
+
+        // ARE EQUAL ----------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static bool const areEqual( fract< Calc1 > const & lhs,
+                                    fract< Calc2 > const & rhs )
+        {
+            return compare( lhs, rhs ) == 0;
+        }
+
+        // IS LESS ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static bool const isLess( fract< Calc1 > const & lhs,
+                                  fract< Calc2 > const & rhs )
+        {
+            return compare( lhs, rhs ) < 0;
+        }
+
+        // IS LESS OR EQUAL ---------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            return compare( lhs, rhs ) <= 0;
+        }
+
+        // IS GREATER ---------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static bool const isGreater( fract< Calc1 > const & lhs,
+                                     fract< Calc2 > const & rhs )
+        {
+            return compare( lhs, rhs ) > 0;
+        }
+
+        // IS GREATER OR EQUAL ------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static bool const isGreaterOrEqual( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            return compare( lhs, rhs ) >= 0;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PI -----------------------------------------------------------------
+
+        /*  The constant [PI] is initialised to
+         *  2646693125139304345/842468587426513207, which is accurate to 37
+         *  decimal places. This and similar fractions can be found at:
+         *  http://qin.laya.com/tech_projects_approxpi.html
+         */
+
+        static fract< PromotingFractCalculator > const PI;
+        static fract< PromotingFractCalculator > const TWO_PI;
+        static fract< PromotingFractCalculator > const HALF_PI;
+
+        // EULER'S CONSTANT ---------------------------------------------------
+
+        /*  The constant [E] is initialised to 685/252, which is accurate to 4
+         *  decimal places. This fraction was calculated as a sum of the
+         *  infinite series:
+         *  e = sum( 1 / n! ) [0 <= n < infinity]
+         */
+
+        static fract< PromotingFractCalculator > const E;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef int_type::word_type word_type;
+
+        typedef fract< UnsafeFractCalculator > word_fract;
+        typedef fract< BigFractCalculator > big_fract;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // WIDEN --------------------------------------------------------------
+
+        template< class Calc >
+        static big_fract const widen( fract< Calc > const & x )
+        {
+            int_type const & numer = x.getNumerator();
+            int_type const & denom = x.getDenominator();
+
+            return big_fract::fromReduced( numer.toBig(),
+                                           denom.toBig(),
+                                           x.isPositive() );
+        }
+
+        // NARROW -------------------------------------------------------------
+
+        /*  Converts a result back, demoting components that fit inline.
+         */
+
+        template< class Calc >
+        static fract< Calc > const narrow( big_fract const & x )
+        {
+            return fract< Calc >::fromReduced( int_type( x.getNumerator() ),
+                                               int_type( x.getDenominator() ),
+                                               x.isPositive() );
+        }
+
+        // COMPARE ------------------------------------------------------------
+
+        /*  Compares inline components as 64-bit fractions, and anything else
+         *  as big fractions.
+         */
+
+        template< class Calc1, class Calc2 >
+        static int const compare( fract< Calc1 > const & lhs,
+                                  fract< Calc2 > const & rhs )
+        {
+            int_type const & lNumer = lhs.getNumerator();
+            int_type const & lDenom = lhs.getDenominator();
+            int_type const & rNumer = rhs.getNumerator();
+            int_type const & rDenom = rhs.getDenominator();
+
+            if( lNumer.isInline() && lDenom.isInline() &&
+                rNumer.isInline() && rDenom.isInline() )
+            {
+                return FractComparator::compare
+                (
+                    word_fract::fromReduced( lNumer.getInline(),
+                                             lDenom.getInline(),
+                                             lhs.isPositive() ),
+                    word_fract::fromReduced( rNumer.getInline(),
+                                             rDenom.getInline(),
+                                             rhs.isPositive() )
+                );
+            }
+
+            return FractComparator::compare( widen( lhs ), widen( rhs ) );
+        }
+
+        #if defined( __SIZEOF_INT128__ )
+
+        // ADD INLINE ---------------------------------------------------------
+
+        /*  Adds inline fractions as [UnsafeFractCalculator] does, with the
+         *  scaled numerators and the result held in 128 bits. Inline
+         *  components are below 2^63, so none of this can overflow.
+         */
+
+        template< class Calc >
+        static fract< Calc > const addInline( word_type const lNumer,
+                                              word_type const lDenom,
+                                              bool const lPositive,
+                                              word_type const rNumer,
+                                              word_type const rDenom,
+                                              bool const rPositive )
+        {
+            typedef unsigned __int128 wide_type;
+
+            // Scale numerators to the least common multiple of denominators
+
+            word_type const divisor = gcd( lDenom, rDenom );
+            word_type const lScale = rDenom / divisor;
+            word_type const rScale = lDenom / divisor;
+
+            wide_type const lScaled = ( wide_type )lNumer * lScale;
+            wide_type const rScaled = ( wide_type )rNumer * rScale;
+
+            // Use signs to determine process
+
+            wide_type numer = 0;
+            bool positive = lPositive;
+
+            if( lPositive == rPositive )
+            {
+                numer = lScaled + rScaled;
+            }
+            else
+            {
+                if( lScaled > rScaled )
+                {
+                    numer = lScaled - rScaled;
+                }
+                else
+                {
+                    numer = rScaled - lScaled;
+                    positive = rPositive;
+                }
+            }
+
+            // Check for zero numerator
+
+            if( numer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
+
+            // Only the common factor of the denominators can divide the
+            // numerator, so reduce against it with a 64-bit GCD
+
+            wide_type denom = ( wide_type )rScale * rDenom;
+
+            if( divisor != 1 )
+            {
+                word_type const common =
+                    gcd( ( word_type )( numer % divisor ), divisor );
+
+                numer /= common;
+                denom = ( wide_type )rScale * ( rDenom / common );
+            }
+
+            return fract< Calc >::fromReduced( int_type::fromWide( numer ),
+                                               int_type::fromWide( denom ),
+                                               positive );
+        }
+
+        // PRODUCT INLINE -----------------------------------------------------
+
+        template< class Calc >
+        static fract< Calc > const productInline( word_type const lNumer,
+                                                  word_type const lDenom,
+                                                  word_type const rNumer,
+                                                  word_type const rDenom,
+                                                  bool const positive )
+        {
+            typedef unsigned __int128 wide_type;
+
+            // Check for zero numerators
+
+            if( lNumer == 0 || rNumer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
+
+            // Cancel common factors across the operands
+
+            word_type const lCommon = gcd( lNumer, rDenom );
+            word_type const rCommon = gcd( rNumer, lDenom );
+
+            return fract< Calc >::fromReduced
+            (
+                int_type::fromWide( ( wide_type )( lNumer / lCommon ) *
+                                    ( rNumer / rCommon ) ),
+                int_type::fromWide( ( wide_type )( lDenom / rCommon ) *
+                                    ( rDenom / lCommon ) ),
+                positive
+            );
+        }
+
+        #endif
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // PI ---------------------------------------------------------------------
+
+    fract< PromotingFractCalculator > const
+    PromotingFractCalculator::PI =
+    fract< PromotingFractCalculator >( 2646693125139304345u,
+                                       842468587426513207u,
+                                       true );
+
+    fract< PromotingFractCalculator > const
+    PromotingFractCalculator::TWO_PI =
+    PromotingFractCalculator::PI *
+    fract< PromotingFractCalculator >( 2, true );
+
+    fract< PromotingFractCalculator > const
+    PromotingFractCalculator::HALF_PI =
+    PromotingFractCalculator::PI /
+    fract< PromotingFractCalculator >( 2, true );
+
+    // EULER'S CONSTANT -------------------------------------------------------
+
+    fract< PromotingFractCalculator > const
+    PromotingFractCalculator::E =
+    fract< PromotingFractCalculator >( 685, 252, true );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // PROMOTING_FRACT_CALCULATOR_H
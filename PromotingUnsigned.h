@@ -0,0 +1,631 @@
+#ifndef PROMOTING_UNSIGNED_H
+#define PROMOTING_UNSIGNED_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <limits>
+
+#include "WideIntegerTraits.h"
+#include "BigUnsigned.h"
+#include "GcdEngine.h"
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PROMOTING UNSIGNED CLASS +++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Unsigned integer occupying a single 64-bit word. Values up to
+     *  [INLINE_MAX] are stored in the word itself, tagged by a set low bit.
+     *  Larger values promote to a heap allocated [BigUnsigned], which holds
+     *  up to 128 bits without further allocation, and the word stores the
+     *  pointer. Results that fit back into the word are demoted again, so
+     *  values only stay on the heap for as long as they need to.
+     */
+
+    class PromotingUnsigned
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef std::uint64_t word_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        static word_type const INLINE_MAX = ~( word_type )0 >> 1;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        PromotingUnsigned( void )
+        {
+            this->word = 1;
+        }
+
+        PromotingUnsigned( word_type const value )
+        {
+            this->word = 1;
+            this->assign( value );
+        }
+
+        explicit PromotingUnsigned( BigUnsigned const & value )
+        {
+            this->word = 1;
+            this->assign( value );
+        }
+
+        explicit PromotingUnsigned( BigUnsigned && value )
+        {
+            this->word = 1;
+            this->assign( std::move( value ) );
+        }
+
+        // COPY CONSTRUCTOR ---------------------------------------------------
+
+        PromotingUnsigned( PromotingUnsigned const & other )
+        {
+            this->word = other.isInline() ?
+                         other.word :
+                         fromPointer( new BigUnsigned( other.getBig() ) );
+        }
+
+        // MOVE CONSTRUCTOR ---------------------------------------------------
+
+        PromotingUnsigned( PromotingUnsigned && other )
+        {
+            this->word = other.word;
+            other.word = 1;
+        }
+
+        // DESTRUCTOR ---------------------------------------------------------
+
+        ~PromotingUnsigned( void )
+        {
+            this->release();
+        }
+
+        #if defined( __SIZEOF_INT128__ )
+
+        // FROM WIDE ----------------------------------------------------------
+
+        static PromotingUnsigned fromWide( unsigned __int128 const value )
+        {
+            if( ( value >> 64 ) == 0 )
+            {
+                return PromotingUnsigned( ( word_type )value );
+            }
+
+            BigUnsigned big( ( word_type )( value >> 64 ) );
+
+            big <<= 64;
+            big += BigUnsigned( ( word_type )value );
+
+            PromotingUnsigned result;
+
+            result.word = fromPointer( new BigUnsigned( std::move( big ) ) );
+
+            return result;
+        }
+
+        #endif
+
+        // IS INLINE ----------------------------------------------------------
+
+        bool const isInline( void ) const
+        {
+            return ( this->word & 1 ) != 0;
+        }
+
+        // GET INLINE ---------------------------------------------------------
+
+        word_type const getInline( void ) const
+        {
+            DEBUG_CODE( assert( this->isInline() ) );
+
+            return this->word >> 1;
+        }
+
+        // GET BIG ------------------------------------------------------------
+
+        BigUnsigned const & getBig( void ) const
+        {
+            DEBUG_CODE( assert( !( this->isInline() ) ) );
+
+            return *toPointer( this->word );
+        }
+
+        // TO BIG -------------------------------------------------------------
+
+        BigUnsigned const toBig( void ) const
+        {
+            return this->isInline() ? BigUnsigned( this->getInline() ) :
+                                      this->getBig();
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC OPERATORS +++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // COPY ASSIGNMENT ----------------------------------------------------
+
+        PromotingUnsigned & operator = ( PromotingUnsigned const & other )
+        {
+            if( other.isInline() )
+            {
+                this->release();
+                this->word = other.word;
+            }
+            else if( this != &other )
+            {
+                this->assign( other.getBig() );
+            }
+
+            return *this;
+        }
+
+        // MOVE ASSIGNMENT ----------------------------------------------------
+
+        PromotingUnsigned & operator = ( PromotingUnsigned && other )
+        {
+            if( this != &other )
+            {
+                this->release();
+                this->word = other.word;
+                other.word = 1;
+            }
+
+            return *this;
+        }
+
+        // CONVERSIONS --------------------------------------------------------
+
+        explicit operator word_type( void ) const
+        {
+            return this->isInline() ? this->getInline() :
+                                      ( word_type )this->getBig();
+        }
+
+        explicit operator BigUnsigned( void ) const
+        {
+            return this->toBig();
+        }
+
+        explicit operator long double( void ) const
+        {
+            return this->isInline() ? ( long double )this->getInline() :
+                                      ( long double )this->getBig();
+        }
+
+        explicit operator double( void ) const
+        {
+            return ( double )( long double )( *this );
+        }
+
+        explicit operator float( void ) const
+        {
+            return ( float )( long double )( *this );
+        }
+
+        // COMPOUND ASSIGNMENT ------------------------------------------------
+
+        PromotingUnsigned & operator += ( PromotingUnsigned const & rhs )
+        {
+            return ( *this ) = ( *this ) + rhs;
+        }
+
+        PromotingUnsigned & operator -= ( PromotingUnsigned const & rhs )
+        {
+            return ( *this ) = ( *this ) - rhs;
+        }
+
+        PromotingUnsigned & operator *= ( PromotingUnsigned const & rhs )
+        {
+            return ( *this ) = ( *this ) * rhs;
+        }
+
+        PromotingUnsigned & operator /= ( PromotingUnsigned const & rhs )
+        {
+            return ( *this ) = ( *this ) / rhs;
+        }
+
+        PromotingUnsigned & operator %= ( PromotingUnsigned const & rhs )
+        {
+            return ( *this ) = ( *this ) % rhs;
+        }
+
+        // ARITHMETIC ---------------------------------------------------------
+
+        /*  Each operator works on the words directly when both operands are
+         *  inline, and on [BigUnsigned] otherwise.
+         */
+
+        friend PromotingUnsigned operator + ( PromotingUnsigned const & lhs,
+                                              PromotingUnsigned const & rhs )
+        {
+            if( lhs.isInline() && rhs.isInline() )
+            {
+                return PromotingUnsigned( lhs.getInline() + rhs.getInline() );
+            }
+
+            BigUnsigned lTemp;
+            BigUnsigned rTemp;
+
+            return PromotingUnsigned( view( lhs, lTemp ) + view( rhs, rTemp ) );
+        }
+
+        friend PromotingUnsigned operator - ( PromotingUnsigned const & lhs,
+                                              PromotingUnsigned const & rhs )
+        {
+            if( lhs.isInline() && rhs.isInline() )
+            {
+                DEBUG_CODE( assert( lhs.getInline() >= rhs.getInline() ) );
+
+                return PromotingUnsigned( lhs.getInline() - rhs.getInline() );
+            }
+
+            BigUnsigned lTemp;
+            BigUnsigned rTemp;
+
+            return PromotingUnsigned( view( lhs, lTemp ) - view( rhs, rTemp ) );
+        }
+
+        friend PromotingUnsigned operator * ( PromotingUnsigned const & lhs,
+                                              PromotingUnsigned const & rhs )
+        {
+            #if defined( __SIZEOF_INT128__ )
+
+            if( lhs.isInline() && rhs.isInline() )
+            {
+                return fromWide( ( unsigned __int128 )lhs.getInline() *
+                                 rhs.getInline() );
+            }
+
+            #endif
+
+            BigUnsigned lTemp;
+            BigUnsigned rTemp;
+
+            return PromotingUnsigned( view( lhs, lTemp ) * view( rhs, rTemp ) );
+        }
+
+        friend PromotingUnsigned operator / ( PromotingUnsigned const & lhs,
+                                              PromotingUnsigned const & rhs )
+        {
+            if( lhs.isInline() && rhs.isInline() )
+            {
+                return PromotingUnsigned( lhs.getInline() / rhs.getInline() );
+            }
+
+            BigUnsigned lTemp;
+            BigUnsigned rTemp;
+
+            return PromotingUnsigned( view( lhs, lTemp ) / view( rhs, rTemp ) );
+        }
+
+        friend PromotingUnsigned operator % ( PromotingUnsigned const & lhs,
+                                              PromotingUnsigned const & rhs )
+        {
+            if( lhs.isInline() && rhs.isInline() )
+            {
+                return PromotingUnsigned( lhs.getInline() % rhs.getInline() );
+            }
+
+            BigUnsigned lTemp;
+            BigUnsigned rTemp;
+
+            return PromotingUnsigned( view( lhs, lTemp ) % view( rhs, rTemp ) );
+        }
+
+        // COMPARISON ---------------------------------------------------------
+
+        friend bool const operator == ( PromotingUnsigned const & lhs,
+                                        PromotingUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) == 0;
+        }
+
+        friend bool const operator != ( PromotingUnsigned const & lhs,
+                                        PromotingUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) != 0;
+        }
+
+        friend bool const operator < ( PromotingUnsigned const & lhs,
+                                       PromotingUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) < 0;
+        }
+
+        friend bool const operator <= ( PromotingUnsigned const & lhs,
+                                        PromotingUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) <= 0;
+        }
+
+        friend bool const operator > ( PromotingUnsigned const & lhs,
+                                       PromotingUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) > 0;
+        }
+
+        friend bool const operator >= ( PromotingUnsigned const & lhs,
+                                        PromotingUnsigned const & rhs )
+        {
+            return compare( lhs, rhs ) >= 0;
+        }
+
+        // OUTPUT STREAM OPERATOR ---------------------------------------------
+
+        friend std::ostream & operator << ( std::ostream & out,
+                                            PromotingUnsigned const & value )
+        {
+            if( value.isInline() )
+            {
+                return out << value.getInline();
+            }
+
+            return out << value.getBig();
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // POINTER CONVERSIONS ------------------------------------------------
+
+        static word_type const fromPointer( BigUnsigned * const pointer )
+        {
+            return ( word_type )reinterpret_cast< std::uintptr_t >( pointer );
+        }
+
+        static BigUnsigned * toPointer( word_type const word )
+        {
+            return reinterpret_cast< BigUnsigned * >( ( std::uintptr_t )word );
+        }
+
+        // ASSIGN -------------------------------------------------------------
+
+        void assign( word_type const value )
+        {
+            if( value <= INLINE_MAX )
+            {
+                this->release();
+                this->word = ( value << 1 ) | 1;
+            }
+            else
+            {
+                this->assign( BigUnsigned( value ) );
+            }
+        }
+
+        /*  Stores [value] inline if it fits, otherwise on the heap, reusing
+         *  an existing allocation.
+         */
+
+        void assign( BigUnsigned const & value )
+        {
+            if( value.limbCount() <= 1 && value.getLimb( 0 ) <= INLINE_MAX )
+            {
+                this->release();
+                this->word = ( value.getLimb( 0 ) << 1 ) | 1;
+            }
+            else if( this->isInline() )
+            {
+                this->word = fromPointer( new BigUnsigned( value ) );
+            }
+            else
+            {
+                *toPointer( this->word ) = value;
+            }
+        }
+
+        void assign( BigUnsigned && value )
+        {
+            if( value.limbCount() <= 1 && value.getLimb( 0 ) <= INLINE_MAX )
+            {
+                this->release();
+                this->word = ( value.getLimb( 0 ) << 1 ) | 1;
+            }
+            else if( this->isInline() )
+            {
+                this->word =
+                    fromPointer( new BigUnsigned( std::move( value ) ) );
+            }
+            else
+            {
+                *toPointer( this->word ) = std::move( value );
+            }
+        }
+
+        // RELEASE ------------------------------------------------------------
+
+        void release( void )
+        {
+            if( !( this->isInline() ) )
+            {
+                delete toPointer( this->word );
+                this->word = 1;
+            }
+        }
+
+        // VIEW ---------------------------------------------------------------
+
+        /*  Returns [x] as a [BigUnsigned], using [temp] to hold inline
+         *  values so heap values are not copied.
+         */
+
+        static BigUnsigned const & view( PromotingUnsigned const & x,
+                                         BigUnsigned & temp )
+        {
+            if( x.isInline() )
+            {
+                temp = BigUnsigned( x.getInline() );
+                return temp;
+            }
+
+            return x.getBig();
+        }
+
+        // COMPARE ------------------------------------------------------------
+
+        static int const compare( PromotingUnsigned const & lhs,
+                                  PromotingUnsigned const & rhs )
+        {
+            // Tagged words order the same way as the values they hold
+
+            if( lhs.isInline() && rhs.isInline() )
+            {
+                return ( lhs.word < rhs.word ) ? -1 :
+                       ( ( rhs.word < lhs.word ) ? 1 : 0 );
+            }
+
+            BigUnsigned lTemp;
+            BigUnsigned rTemp;
+
+            return BigUnsigned::compare( view( lhs, lTemp ),
+                                         view( rhs, rTemp ) );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        word_type word;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        friend class PromotingGcd;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PROMOTING GCD CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Uses the binary engine on inline values and Lehmer's algorithm once
+     *  either operand has been promoted.
+     */
+
+    class PromotingGcd
+    {
+        public:
+
+        // GCD ----------------------------------------------------------------
+
+        static PromotingUnsigned gcd( PromotingUnsigned const & a,
+                                            PromotingUnsigned const & b )
+        {
+            typedef PromotingUnsigned::word_type word_type;
+
+            if( a.isInline() && b.isInline() )
+            {
+                return PromotingUnsigned
+                (
+                    GcdEngine< word_type >::gcd( a.getInline(), b.getInline() )
+                );
+            }
+
+            BigUnsigned aTemp;
+            BigUnsigned bTemp;
+
+            return PromotingUnsigned
+            (
+                LehmerGcd::gcd( PromotingUnsigned::view( a, aTemp ),
+                                PromotingUnsigned::view( b, bTemp ) )
+            );
+        }
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ENGINE AND TRAITS SPECIALISATIONS ++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template<>
+    class GcdEngine< PromotingUnsigned > : public PromotingGcd
+    {
+    };
+
+    /*  Products of [PromotingUnsigned] promote instead of overflowing, so it
+     *  is its own wide type.
+     */
+
+    template<>
+    class WideIntegerTraits< PromotingUnsigned, false >
+    {
+        public:
+
+        static bool const hasWideType = true;
+        typedef PromotingUnsigned wide_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NUMERIC LIMITS +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/*  [PromotingUnsigned] is unbounded. As for [BigUnsigned], [digits] and
+ *  [max] describe the range fract converts exactly from floating point.
+ */
+
+namespace std
+{
+    template<>
+    class numeric_limits< fract::PromotingUnsigned >
+    {
+        public:
+
+        static bool const is_specialized = true;
+        static bool const is_signed = false;
+        static bool const is_integer = true;
+        static bool const is_exact = true;
+        static bool const is_bounded = false;
+        static bool const is_modulo = false;
+
+        static int const radix = 2;
+        static int const digits = 64;
+        static int const digits10 = 19;
+
+        static fract::PromotingUnsigned const min( void )
+        {
+            return fract::PromotingUnsigned();
+        }
+
+        static fract::PromotingUnsigned const lowest( void )
+        {
+            return fract::PromotingUnsigned();
+        }
+
+        static fract::PromotingUnsigned const max( void )
+        {
+            return fract::PromotingUnsigned( ~( std::uint64_t )0 );
+        }
+    };
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // PROMOTING_UNSIGNED_H
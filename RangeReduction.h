@@ -0,0 +1,292 @@
+#ifndef RANGE_REDUCTION_H
+#define RANGE_REDUCTION_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cstdint>
+
+#include "WideIntegerTraits.h"
+#include "GcdEngine.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // RANGE REDUCTION CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Splits the magnitude of an angle into a whole number of quarter
+     *  turns and a remainder in [ 0, HALF_PI ), working on the components
+     *  directly rather than through floating-point.
+     *
+     *  This version uses the arithmetic of [Calculator] against its own
+     *  [HALF_PI], which is exact for calculators that cannot overflow.
+     */
+
+    template
+    <
+        class Calculator,
+        bool IsBuiltin =
+            std::is_integral
+            <
+                typename fract< Calculator >::int_type
+            >::value &&
+            sizeof( typename fract< Calculator >::int_type ) <= 8 &&
+            UnsignedOfSize< 16 >::exists
+    >
+    class RangeReduction
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // REDUCE -------------------------------------------------------------
+
+        static fract< Calculator > const reduce( fract< Calculator > const & x,
+                                                 unsigned & quadrant )
+        {
+            typedef fract< Calculator > fract_type;
+            typedef typename fract_type::int_type int_type;
+
+            fract_type remainder( x );
+            remainder.makePositive();
+
+            quadrant = 0;
+
+            // A zero denominator, the invalid state of some calculators,
+            // passes through rather than dividing by zero below
+
+            if( x.getDenominator() == 0 || remainder < fract_type::HALF_PI )
+            {
+                return remainder;
+            }
+
+            // Take whole quarter turns off the magnitude
+
+            fract_type const quotient = remainder / fract_type::HALF_PI;
+            int_type const turns =
+                quotient.getNumerator() / quotient.getDenominator();
+
+            remainder -= fract_type::HALF_PI * fract_type( turns, true );
+            quadrant = unsigned( std::uint64_t( turns % int_type( 4 ) ) );
+
+            return remainder;
+        }
+
+        // REDUCE OCTANT ------------------------------------------------------
+
+        /*  As [reduce], but a remainder past HALF_PI / 2 is taken from
+         *  HALF_PI, leaving it in [ 0, HALF_PI / 2 ]. [octant] is set to
+         *  twice the quadrant, plus one if the remainder was folded.
+         */
+
+        static fract< Calculator > const reduceOctant
+        (
+            fract< Calculator > const & x,
+            unsigned & octant
+        )
+        {
+            typedef fract< Calculator > fract_type;
+
+            unsigned quadrant = 0;
+            fract_type remainder = reduce( x, quadrant );
+
+            octant = 2 * quadrant;
+
+            if( remainder > fract_type::HALF_PI / fract_type( 2, true ) )
+            {
+                remainder = fract_type::HALF_PI - remainder;
+                octant += 1;
+            }
+
+            return remainder;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    /*  Builtin components of up to 64 bits are reduced against PI as
+     *  2646693125139304345/842468587426513207, the fraction used by the
+     *  safe calculators, whatever the precision of [Calculator]'s own
+     *  constant. Products of a component with either word of PI are formed
+     *  in 128 bits, so the quarter turns and the remainder are exact. The
+     *  remainder is returned as is when its reduced components fit the
+     *  storage, and otherwise both are shifted down until they do, which
+     *  keeps all but the last bit or so of [int_type]'s precision.
+     */
+
+    template< class Calculator >
+    class RangeReduction< Calculator, true >
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // REDUCE -------------------------------------------------------------
+
+        static fract< Calculator > const reduce( fract< Calculator > const & x,
+                                                 unsigned & quadrant )
+        {
+            unsigned octant = 0;
+            fract< Calculator > const remainder = split( x, false, octant );
+
+            quadrant = octant / 2;
+
+            return remainder;
+        }
+
+        // REDUCE OCTANT ------------------------------------------------------
+
+        static fract< Calculator > const reduceOctant
+        (
+            fract< Calculator > const & x,
+            unsigned & octant
+        )
+        {
+            return split( x, true, octant );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef typename UnsignedOfSize< 16 >::type wide_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        static std::uint64_t const PI_NUMERATOR = 2646693125139304345u;
+        static std::uint64_t const PI_DENOMINATOR = 842468587426513207u;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // SPLIT --------------------------------------------------------------
+
+        /*  Reduces [x] as [reduce], or as [reduceOctant] when [fold] is set,
+         *  counting eighth turns in [octant]. HALF_PI less the remainder
+         *  shares its denominator, so folding is exact too.
+         */
+
+        static fract< Calculator > const split( fract< Calculator > const & x,
+                                                bool const fold,
+                                                unsigned & octant )
+        {
+            typedef fract< Calculator > fract_type;
+            typedef typename fract_type::int_type int_type;
+            typedef typename fract_type::storage_type storage_type;
+
+            // An invalid fraction passes through, as in the version above
+
+            if( x.getDenominator() == 0 )
+            {
+                octant = 0;
+
+                return x;
+            }
+
+            // |x| / HALF_PI == ( 2 * n * PI_DENOMINATOR ) /
+            //                  ( d * PI_NUMERATOR )
+
+            wide_type const numer = wide_type( x.getNumerator() );
+            wide_type const denom = wide_type( x.getDenominator() );
+
+            wide_type const dividend = numer * halfTurnDenominator();
+            wide_type const divisor = denom * wide_type( PI_NUMERATOR );
+            wide_type const turns = dividend / divisor;
+
+            // The remainder over the same denominator as the dividend
+
+            wide_type remNumer = dividend - ( turns * divisor );
+            wide_type remDenom = denom * halfTurnDenominator();
+
+            octant = unsigned( 2 * ( turns & 3 ) );
+
+            if( fold && remNumer > divisor - remNumer )
+            {
+                remNumer = divisor - remNumer;
+                octant += 1;
+            }
+            else if( turns == 0 )
+            {
+                fract_type remainder( x );
+                remainder.makePositive();
+
+                return remainder;
+            }
+
+            if( remNumer == 0 )
+            {
+                return fract_type( 0, true );
+            }
+
+            wide_type const common =
+                GcdEngine< wide_type >::gcd( remNumer, remDenom );
+
+            remNumer /= common;
+            remDenom /= common;
+
+            // Return exactly if possible, otherwise round to fit
+
+            wide_type const limit = wide_type( storage_type::maxDenominator() );
+
+            if( remNumer <= limit && remDenom <= limit )
+            {
+                return fract_type::fromReduced( int_type( remNumer ),
+                                                int_type( remDenom ),
+                                                true );
+            }
+
+            while( remNumer > limit || remDenom > limit )
+            {
+                remNumer >>= 1;
+                remDenom >>= 1;
+            }
+
+            return fract_type( int_type( remNumer ),
+                               int_type( remDenom ),
+                               true );
+        }
+
+        // HALF TURN DENOMINATOR ----------------------------------------------
+
+        /*  The denominator of HALF_PI, which needs 61 bits.
+         */
+
+        static constexpr wide_type const halfTurnDenominator( void )
+        {
+            return 2 * wide_type( PI_DENOMINATOR );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // RANGE_REDUCTION_H
@@ -5,8 +5,14 @@
 // INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+#include <type_traits>
 #include <cstdint>
+#include <atomic>
 
+#include "WideFractCalculator.h"
+#include "OverflowArithmetic.h"
+#include "WideIntegerTraits.h"
+#include "FractComparator.h"
 #include "debug.h"
 #include "fract.h"
 
@@ -26,7 +32,14 @@ namespace fract
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // SAFE FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++++++++++++++
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    
+
+    /*  Performs exact arithmetic on fractions in lowest terms, checking
+     *  every step with [addOverflows] and [mulOverflows]. Only a result
+     *  that cannot be represented is computed in floating-point and
+     *  converted back, which is then approximate. Fallbacks are counted
+     *  per operation, see [fallbackCount].
+     */
+
     class SafeFractCalculator
     {
         public:
@@ -38,16 +51,40 @@ namespace fract
         typedef std::uint64_t int_type;
         typedef long double float_type;
 
+        // OPERATION ----------------------------------------------------------
+
+        enum Operation
+        {
+            ADDITION,
+            MULTIPLICATION,
+            DIVISION,
+            OPERATION_COUNT
+        };
+
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         
         // ADD ----------------------------------------------------------------
-            
+
         template< class Calc1, class Calc2 >
         static fract< Calc1 > const add( fract< Calc1 > const & lhs,
                                          fract< Calc2 > const & rhs )
         {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            fract< Calc1 > result;
+
+            if( trySum( lhs, rhs, result, has_wide_type() ) )
+            {
+                return result;
+            }
+
+            // Convert fractions to floating-point types and add
+
+            countFallback( ADDITION );
+
             return fract< Calc1 >( toFloatingPoint( lhs ) +
                                    toFloatingPoint( rhs ) );
         }
@@ -58,66 +95,108 @@ namespace fract
         static fract< Calc1 > const mul( fract< Calc1 > const & lhs,
                                          fract< Calc2 > const & rhs )
         {
-            return fract< Calc1 >( toFloatingPoint( lhs ) *
-                                   toFloatingPoint( rhs ) );
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     rhs.getDenominator(),
+                                     lhs.isPositive() == rhs.isPositive(),
+                                     MULTIPLICATION );
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                         fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
+            {
+                return fract< Calc1 >( 0, true );
+            }
+
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     lhs.isPositive() == rhs.isPositive(),
+                                     DIVISION );
+        }
+
+        // FALLBACK COUNT -----------------------------------------------------
+
+        /*  Returns how many results of [operation] have been approximated
+         *  since the program started or the counts were last reset. Counts
+         *  are shared by all threads and only touched on the fallback path,
+         *  so exact operations pay nothing for them.
+         */
+
+        static std::uint64_t const fallbackCount( Operation const operation )
+        {
+            DEBUG_CODE( assert( operation < OPERATION_COUNT ) );
+
+            return fallbacks()[ operation ].load( std::memory_order_relaxed );
+        }
+
+        // RESET FALLBACK COUNTS ----------------------------------------------
+
+        static void resetFallbackCounts( void )
+        {
+            for( unsigned i = 0; i < OPERATION_COUNT; i += 1 )
+            {
+                fallbacks()[ i ].store( 0, std::memory_order_relaxed );
+            }
         }
         
         // ARE EQUAL ----------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const areEqual( fract< Calc1 > const & lhs,
-                                    fract< Calc2 > const & rhs )
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
         {
-            float_type flhs = toFloatingPoint( lhs );
-            float_type frhs = toFloatingPoint( rhs );
-            
-            flhs = std::abs( flhs - frhs );
-            
-            return flhs < std::numeric_limits< float_type >::epsilon();
+            return FractComparator::compare( lhs, rhs ) == 0;
         }
         
         // IS LESS ------------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isLess( fract< Calc1 > const & lhs,
-                                  fract< Calc2 > const & rhs )
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
         {
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-            
-            return ( diff + EPSILON ) > 0;
+            return FractComparator::compare( lhs, rhs ) < 0;
         }
         
         // IS LESS OR EQUAL ---------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isLessOrEqual( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-
-            return ( std::abs( diff ) < EPSILON ) || ( diff + EPSILON > 0 );
+            return FractComparator::compare( lhs, rhs ) <= 0;
         }
         
         // IS GREATER ---------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isGreater( fract< Calc1 > const & lhs,
-                                     fract< Calc2 > const & rhs )
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
         {
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-            
-            return ( diff + EPSILON ) < 0;
+            return FractComparator::compare( lhs, rhs ) > 0;
         }
         
         // IS GREATER OR EQUAL ------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isGreaterOrEqual( fract< Calc1 > const & lhs,
-                                            fract< Calc2 > const & rhs )
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
         {
-            float_type diff = toFloatingPoint( lhs ) - toFloatingPoint( rhs );
-
-            return ( std::abs( diff ) < EPSILON ) || ( diff + EPSILON < 0 );
+            return FractComparator::compare( lhs, rhs ) >= 0;
         }
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -130,6 +209,9 @@ namespace fract
          *  2646693125139304345/842468587426513207, which is accurate to 37
          *  decimal places. This and similar fractions can be found at:
          *  http://qin.laya.com/tech_projects_approxpi.html
+         *
+         *  Arithmetic here is not constexpr, so [TWO_PI] and [HALF_PI] are
+         *  written out in full to keep them computable at compile time.
          */
         
         static fract< SafeFractCalculator > const PI;
@@ -150,9 +232,193 @@ namespace fract
         
         private:
         
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef std::integral_constant< bool, UnsignedOfSize< 16 >::exists >
+            has_wide_type;
+
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // TRY SUM ------------------------------------------------------------
+
+        /*  Sets [result] to the exact sum of [lhs] and [rhs] and returns
+         *  true if it fits the storage of [Calc1]. Where a 128-bit type
+         *  exists this is [BasicWideFractCalculator::tryAdd], which checks
+         *  only the reduced result. Otherwise every step must fit 64 bits.
+         */
+
+        template< class Calc1, class Calc2 >
+        static bool const trySum( fract< Calc1 > const & lhs,
+                                  fract< Calc2 > const & rhs,
+                                  fract< Calc1 > & result,
+                                  std::true_type )
+        {
+            typedef BasicWideFractCalculator
+            <
+                typename fract< Calc1 >::int_type
+            >
+            exact_type;
+
+            return exact_type::tryAdd( lhs, rhs, result );
+        }
+
+        template< class Calc1, class Calc2 >
+        static bool const trySum( fract< Calc1 > const & lhs,
+                                  fract< Calc2 > const & rhs,
+                                  fract< Calc1 > & result,
+                                  std::false_type )
+        {
+            // Get fraction components
+
+            int_type const lNumer = lhs.getNumerator();
+            int_type const lDenom = lhs.getDenominator();
+            int_type const rNumer = rhs.getNumerator();
+            int_type const rDenom = rhs.getDenominator();
+
+            // Find scales to the least common multiple of denominators
+
+            int_type const divisor = gcd( lDenom, rDenom );
+            int_type const lScale = rDenom / divisor;
+            int_type const rScale = lDenom / divisor;
+
+            int_type lTerm = 0;
+            int_type rTerm = 0;
+            int_type numer = 0;
+
+            bool const sameSign = lhs.isPositive() == rhs.isPositive();
+            bool positive = lhs.isPositive();
+
+            bool overflow = mulOverflows( lNumer, lScale, lTerm ) ||
+                            mulOverflows( rNumer, rScale, rTerm );
+
+            // Perform addition based on sign
+
+            if( !overflow )
+            {
+                if( sameSign )
+                {
+                    overflow = addOverflows( lTerm, rTerm, numer );
+                }
+                else if( lTerm > rTerm )
+                {
+                    numer = lTerm - rTerm;
+                }
+                else
+                {
+                    numer = rTerm - lTerm;
+                    positive = rhs.isPositive();
+                }
+            }
+
+            if( !overflow )
+            {
+                // Check for zero numerator
+
+                if( numer == 0 )
+                {
+                    result = fract< Calc1 >( 0, true );
+                    return true;
+                }
+
+                // Remove any part of the common factor shared with the
+                // numerator and check the denominator fits the storage
+
+                int_type const common =
+                    ( divisor == 1 ) ? 1 : gcd( numer, divisor );
+
+                int_type denom = 0;
+
+                if( !mulOverflows( rScale, rDenom / common, denom ) &&
+                    denom <= fract< Calc1 >::storage_type::maxDenominator() )
+                {
+                    result = fract< Calc1 >::fromReduced( numer / common,
+                                                          denom,
+                                                          positive );
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // PRODUCT ------------------------------------------------------------
+
+        /*  Falls back on the reduced components, counting against
+         *  [operation].
+         */
+
+        template< class Calc >
+        static fract< Calc > const product( int_type lNumer,
+                                            int_type lDenom,
+                                            int_type rNumer,
+                                            int_type rDenom,
+                                            bool const positive,
+                                            Operation const operation )
+        {
+            // Check for zero numerators
+
+            if( lNumer == 0 || rNumer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
+
+            // Cancel common factors across the operands
+
+            int_type const lCommon = gcd( lNumer, rDenom );
+            int_type const rCommon = gcd( rNumer, lDenom );
+
+            lNumer /= lCommon;
+            rDenom /= lCommon;
+            rNumer /= rCommon;
+            lDenom /= rCommon;
+
+            // Multiply if the products fit
+
+            int_type numer = 0;
+            int_type denom = 0;
+
+            if( !mulOverflows( lNumer, rNumer, numer ) &&
+                !mulOverflows( lDenom, rDenom, denom ) &&
+                denom <= fract< Calc >::storage_type::maxDenominator() )
+            {
+                return fract< Calc >::fromReduced( numer, denom, positive );
+            }
+
+            // Multiply floating-point conversions of reduced components
+
+            countFallback( operation );
+
+            float_type const result =
+                ( ( float_type )lNumer / ( float_type )lDenom ) *
+                ( ( float_type )rNumer / ( float_type )rDenom );
+
+            return fract< Calc >( positive ? result : -result );
+        }
+
+        // FALLBACKS ----------------------------------------------------------
+
+        /*  The counters have static storage and trivial construction, so
+         *  they are zeroed before the program starts and need no guard.
+         */
+
+        static std::atomic< std::uint64_t > * fallbacks( void )
+        {
+            static std::atomic< std::uint64_t > counts[ OPERATION_COUNT ];
+
+            return counts;
+        }
+
+        // COUNT FALLBACK -----------------------------------------------------
+
+        static void countFallback( Operation const operation )
+        {
+            fallbacks()[ operation ].fetch_add( 1, std::memory_order_relaxed );
+        }
             
         // TO FLOATING POINT --------------------------------------------------
         
@@ -171,14 +437,6 @@ namespace fract
             }
         }
 
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-        // EPSILON ------------------------------------------------------------
-
-        static float_type const EPSILON;
-        
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     };
     
@@ -188,38 +446,30 @@ namespace fract
     
     // PI ---------------------------------------------------------------------
     
-    fract< SafeFractCalculator > const
+    constexpr fract< SafeFractCalculator > const
     SafeFractCalculator::PI =
     fract< SafeFractCalculator >( 2646693125139304345,
                                   842468587426513207,
                                   true );
     
-    fract< SafeFractCalculator > const
+    constexpr fract< SafeFractCalculator > const
     SafeFractCalculator::TWO_PI =
-    SafeFractCalculator::PI *
-    fract< SafeFractCalculator >( 2, true );
+    fract< SafeFractCalculator >( 5293386250278608690,
+                                  842468587426513207,
+                                  true );
     
-    fract< SafeFractCalculator > const
+    constexpr fract< SafeFractCalculator > const
     SafeFractCalculator::HALF_PI = 
-    SafeFractCalculator::PI /
-    fract< SafeFractCalculator >( 2, true );
+    fract< SafeFractCalculator >( 2646693125139304345,
+                                  1684937174853026414,
+                                  true );
     
     // EULER'S CONSTANT -------------------------------------------------------
     
-    fract< SafeFractCalculator > const
+    constexpr fract< SafeFractCalculator > const
     SafeFractCalculator::E = 
     fract< SafeFractCalculator >( 685, 252, true );
 
-    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // PRIVATE STATIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-    // EPSILON ----------------------------------------------------------------
-
-    SafeFractCalculator::float_type const
-    SafeFractCalculator::EPSILON =
-    std::numeric_limits< float_type >::epsilon();
-    
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 }
 
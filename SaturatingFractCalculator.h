@@ -0,0 +1,263 @@
+#ifndef SATURATING_FRACT_CALCULATOR_H
+#define SATURATING_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+#include <limits>
+
+#include "WideFractCalculator.h"
+#include "FractComparator.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BASIC SATURATING FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Performs exact arithmetic as [BasicWideFractCalculator] does, but
+     *  never throws or wraps. A result whose magnitude is too large for
+     *  [IntType] is clamped to the largest whole number of the same sign.
+     *  A result that is in range but whose reduced components do not fit
+     *  is computed in floating-point and converted back, which is then
+     *  approximate.
+     *
+     *  Both cases are handled after the exact attempt fails, so operations
+     *  that fit cost the same as on the wide calculator.
+     */
+
+    template< class IntType >
+    class BasicSaturatingFractCalculator
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+        typedef long double float_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( exact_type::tryAdd( lhs, rhs, result ) )
+            {
+                return result;
+            }
+
+            return saturate< Calc1 >( lhs.toLongDouble() +
+                                      rhs.toLongDouble() );
+        }
+
+        // MUL ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( exact_type::tryMul( lhs, rhs, result ) )
+            {
+                return result;
+            }
+
+            return saturate< Calc1 >( lhs.toLongDouble() *
+                                      rhs.toLongDouble() );
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( exact_type::tryDiv( lhs, rhs, result ) )
+            {
+                return result;
+            }
+
+            return saturate< Calc1 >( lhs.toLongDouble() /
+                                      rhs.toLongDouble() );
+        }
+
+        // ARE EQUAL ----------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) == 0;
+        }
+
+        // IS LESS ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) < 0;
+        }
+
+        // IS LESS OR EQUAL ---------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) <= 0;
+        }
+
+        // IS GREATER ---------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) > 0;
+        }
+
+        // IS GREATER OR EQUAL ------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) >= 0;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PI -----------------------------------------------------------------
+
+        static fract< BasicSaturatingFractCalculator > const PI;
+        static fract< BasicSaturatingFractCalculator > const TWO_PI;
+        static fract< BasicSaturatingFractCalculator > const HALF_PI;
+
+        // EULER'S CONSTANT ---------------------------------------------------
+
+        static fract< BasicSaturatingFractCalculator > const E;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef BasicWideFractCalculator< IntType > exact_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // SATURATE -----------------------------------------------------------
+
+        /*  Returns the fraction of [Calc] nearest [value], clamping
+         *  magnitudes beyond the largest whole number.
+         */
+
+        template< class Calc >
+        static fract< Calc > const saturate( float_type const value )
+        {
+            int_type const intMax = std::numeric_limits< int_type >::max();
+
+            if( value >= ( float_type )intMax )
+            {
+                return fract< Calc >::fromReduced( intMax, 1, true );
+            }
+
+            if( value <= -( float_type )intMax )
+            {
+                return fract< Calc >::fromReduced( intMax, 1, false );
+            }
+
+            return fract< Calc >( value );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // PI ---------------------------------------------------------------------
+
+    template< class IntType >
+    constexpr fract< BasicSaturatingFractCalculator< IntType > > const
+    BasicSaturatingFractCalculator< IntType >::TWO_PI =
+    BasicSaturatingFractCalculator< IntType >::PI *
+    fract< BasicSaturatingFractCalculator< IntType > >( 2, true );
+
+    template< class IntType >
+    constexpr fract< BasicSaturatingFractCalculator< IntType > > const
+    BasicSaturatingFractCalculator< IntType >::HALF_PI =
+    BasicSaturatingFractCalculator< IntType >::PI /
+    fract< BasicSaturatingFractCalculator< IntType > >( 2, true );
+
+    template< class IntType >
+    constexpr fract< BasicSaturatingFractCalculator< IntType > > const
+    BasicSaturatingFractCalculator< IntType >::PI =
+    fract< BasicSaturatingFractCalculator< IntType > >
+    (
+        WidePi< IntType >::numerator(),
+        WidePi< IntType >::denominator(),
+        true
+    );
+
+    // EULER'S CONSTANT -------------------------------------------------------
+
+    template< class IntType >
+    constexpr fract< BasicSaturatingFractCalculator< IntType > > const
+    BasicSaturatingFractCalculator< IntType >::E =
+    fract< BasicSaturatingFractCalculator< IntType > >( 685, 252, true );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // SATURATING FRACT CALCULATOR ++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    #if defined( __SIZEOF_INT128__ )
+
+    typedef BasicSaturatingFractCalculator< std::uint64_t >
+        SaturatingFractCalculator;
+
+    #endif
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // SATURATING_FRACT_CALCULATOR_H
@@ -0,0 +1,257 @@
+#ifndef SIN_COS_SYMBOL_H
+#define SIN_COS_SYMBOL_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "ValueSymbol.h"
+#include "Symbol.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // SINE AND COSINE SYMBOL CLASS +++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  One half of a sine and cosine pair. Both halves, and every clone of
+     *  either, share a reference counted result holding the child symbol,
+     *  so whichever is evaluated first computes both values with a single
+     *  call to [sincos] and the rest reuse them.
+     */
+
+    template< class ValueType, class Allocator >
+    class SinCosSymbol : public Symbol< ValueType >
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef ValueType value_type;
+        typedef Allocator allocator_type;
+        typedef Symbol< value_type > symbol_type;
+        typedef typename symbol_type::size_type size_type;
+        typedef typename allocator_type::value_type alloc_val_type;
+        typedef ValueSymbol< value_type, allocator_type > val_symbol_type;
+        typedef ValueSymbolBase< value_type > val_symbol_base_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        /*  Creates the sine half for [child], taking ownership of it.
+         */
+
+        SinCosSymbol( symbol_type & child )
+        {
+            this->result =
+                symbol_type::template allocate< Result >( allocator );
+            this->result = new( this->result ) Result( child );
+            this->cosine = false;
+        }
+
+        /*  Creates a half sharing the result of [other], the cosine half
+         *  when [cosine] is true.
+         */
+
+        SinCosSymbol( SinCosSymbol const & other, bool const cosine )
+        {
+            this->result = other.result;
+            this->result->references += 1;
+            this->cosine = cosine;
+        }
+
+        // COPY CONSTRUCTOR ---------------------------------------------------
+
+        SinCosSymbol( SinCosSymbol const & other )
+        {
+            this->result = other.result;
+            this->result->references += 1;
+            this->cosine = other.cosine;
+        }
+
+        // MOVE CONSTRUCTOR ---------------------------------------------------
+
+        SinCosSymbol( SinCosSymbol && other )
+        {
+            this->result = other.result;
+            this->cosine = other.cosine;
+
+            other.result = nullptr;
+        }
+
+        // DESTRUCTOR ---------------------------------------------------------
+
+        virtual ~SinCosSymbol( void )
+        {
+            if( result != nullptr )
+            {
+                result->references -= 1;
+
+                if( result->references == 0 )
+                {
+                    symbol_type::deallocate( allocator, result->child );
+
+                    result->~Result();
+
+                    allocator.deallocate
+                    (
+                        reinterpret_cast< alloc_val_type * >( result ),
+                        sizeof( Result )
+                    );
+                }
+            }
+        }
+
+        // EVALUATE -----------------------------------------------------------
+
+        virtual val_symbol_base_type * evaluate( void )
+        {
+            return this->select();
+        }
+
+        virtual val_symbol_base_type * evaluate( void ) const
+        {
+            return this->select();
+        }
+
+        // SIZE ---------------------------------------------------------------
+
+        virtual size_type const size( void ) const
+        {
+            return sizeof( SinCosSymbol );
+        }
+
+        // CLONE --------------------------------------------------------------
+
+        virtual symbol_type * clone( void ) const
+        {
+            // Return copy of this object, sharing the result
+
+            SinCosSymbol * address =
+                symbol_type::template allocate< SinCosSymbol >( allocator );
+
+            address = new( address ) SinCosSymbol( *this );
+
+            return address;
+        }
+
+        // IS VALUE -----------------------------------------------------------
+
+        virtual bool const isValue( void ) const
+        {
+            return false;
+        }
+
+        // GET ALLOCATOR ------------------------------------------------------
+
+        static allocator_type get_allocator( void )
+        {
+            return allocator;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // RESULT -------------------------------------------------------------
+
+        /*  The child is released once both values are known.
+         */
+
+        class Result
+        {
+            public:
+
+            Result( symbol_type & child ):
+            child( &child ),
+            references( 1 ),
+            evaluated( false )
+            {}
+
+            symbol_type * child;
+            value_type sine;
+            value_type cosine;
+            size_type references;
+            bool evaluated;
+        };
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // SELECT -------------------------------------------------------------
+
+        val_symbol_base_type * select( void ) const
+        {
+            // Evaluate both values on first use
+
+            if( !( result->evaluated ) )
+            {
+                val_symbol_base_type * evalChild = result->child->evaluate();
+
+                sincos( evalChild->getValue(), result->sine, result->cosine );
+
+                symbol_type::deallocate( allocator, evalChild );
+                symbol_type::deallocate( allocator, result->child );
+
+                result->child = nullptr;
+                result->evaluated = true;
+            }
+
+            // Construct new value symbol for this half
+
+            val_symbol_type * value =
+                symbol_type::template allocate< val_symbol_type >( allocator );
+
+            value = new( value ) val_symbol_type( this->cosine
+                                                  ? result->cosine
+                                                  : result->sine );
+
+            return value;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ALLOCATOR ----------------------------------------------------------
+
+        static allocator_type allocator;
+
+        // OPERAND ------------------------------------------------------------
+
+        Result * result;
+
+        bool cosine;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // STATIC DATA OF SINE AND COSINE SYMBOL ++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class ValueType, class Allocator >
+    typename SinCosSymbol< ValueType, Allocator >::allocator_type
+    SinCosSymbol< ValueType, Allocator >::allocator;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // SIN_COS_SYMBOL_H
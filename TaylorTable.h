@@ -0,0 +1,135 @@
+#ifndef TAYLOR_TABLE_H
+#define TAYLOR_TABLE_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cassert>
+
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // TAYLOR TABLE CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Signed reciprocal factorials for the sine and cosine series, built
+     *  once per calculator on first use. Term [i] of sine is
+     *  ( -1 )^( i + 1 ) / ( 2i + 3 )! and of cosine ( -1 )^( i + 1 ) /
+     *  ( 2i + 2 )!, the coefficients of x^( 2i + 3 ) and x^( 2i + 2 ).
+     *
+     *  Each entry is the previous one divided by a small integer using
+     *  [Calculator], so factorials too large for its components are handled
+     *  as its arithmetic handles any other overflow. This is also why the
+     *  table is built at run time rather than in a constant expression.
+     */
+
+    template< class Calculator >
+    class TaylorTable
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        static unsigned const termCount = 9;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // SINE ---------------------------------------------------------------
+
+        static fract< Calculator > const & sine( unsigned const term )
+        {
+            DEBUG_CODE( assert( term < termCount ) );
+
+            return getTable().sines[ term ];
+        }
+
+        // COSINE -------------------------------------------------------------
+
+        static fract< Calculator > const & cosine( unsigned const term )
+        {
+            DEBUG_CODE( assert( term < termCount ) );
+
+            return getTable().cosines[ term ];
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        TaylorTable( void )
+        {
+            typedef typename fract< Calculator >::int_type int_type;
+
+            // Walk the factorials from 1 / 1!, alternating between the even
+            // and odd tables and negating at each even term
+
+            fract< Calculator > coefficient( 1, true );
+
+            for( unsigned i = 0; i < termCount; i += 1 )
+            {
+                coefficient /= fract< Calculator >
+                (
+                    int_type( 2 * i + 2 ), true
+                );
+                coefficient.negate();
+
+                this->cosines[ i ] = coefficient;
+
+                coefficient /= fract< Calculator >
+                (
+                    int_type( 2 * i + 3 ), true
+                );
+
+                this->sines[ i ] = coefficient;
+            }
+        }
+
+        // GET TABLE ----------------------------------------------------------
+
+        static TaylorTable const & getTable( void )
+        {
+            static TaylorTable const table;
+
+            return table;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        fract< Calculator > sines[ termCount ];
+        fract< Calculator > cosines[ termCount ];
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // TAYLOR_TABLE_H
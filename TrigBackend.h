@@ -0,0 +1,275 @@
+#ifndef TRIG_BACKEND_H
+#define TRIG_BACKEND_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cassert>
+#include <utility>
+
+#include "RangeReduction.h"
+#include "MinimaxTable.h"
+#include "TaylorTable.h"
+#include "debug.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // TRIG BACKEND CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Evaluates sine and cosine magnitudes as polynomials in Horner form,
+     *  with coefficients from [Table] ( see [TaylorTable] ). Angles are
+     *  reduced into [ 0, HALF_PI ), or into [ 0, HALF_PI / 2 ] when
+     *  [FoldsOctants] is set, with [RangeReduction].
+     *
+     *  The free functions [sin], [cos], [sincos] and [tan] use the backend
+     *  named by [TrigTraits]; calling one of these directly, such as
+     *  MinimaxTrig::sin( x ), selects a backend for a single call.
+     */
+
+    template< template< class > class Table, bool FoldsOctants >
+    class TrigBackend
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // REDUCE -------------------------------------------------------------
+
+        /*  Returns [x] reduced for the series, setting [swapped] when the
+         *  magnitude of the sine of [x] is that of the cosine of the result
+         *  and vice versa.
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const reduce
+        (
+            fract< Calculator > const & x,
+            bool & swapped
+        )
+        {
+            typedef RangeReduction< Calculator > reduction_type;
+
+            unsigned turns = 0;
+
+            if( FoldsOctants )
+            {
+                fract< Calculator > const nx =
+                    reduction_type::reduceOctant( x, turns );
+
+                // Odd quadrants and folded remainders each swap once
+
+                swapped = ( ( turns ^ ( turns >> 1 ) ) & 1 ) != 0;
+
+                return nx;
+            }
+
+            fract< Calculator > const nx = reduction_type::reduce( x, turns );
+
+            swapped = ( turns & 1 ) != 0;
+
+            return nx;
+        }
+
+        // SINE SERIES --------------------------------------------------------
+
+        /*  Sums the first [terms] terms of the polynomial for sine, on [x2]
+         *  = x^2.
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const sineSeries
+        (
+            fract< Calculator > const & x,
+            fract< Calculator > const & x2,
+            unsigned const terms
+        )
+        {
+            typedef Table< Calculator > table_type;
+
+            DEBUG_CODE( assert( terms > 0 &&
+                                terms <= table_type::termCount + 1 ) );
+
+            if( terms == 1 )
+            {
+                return x;
+            }
+
+            fract< Calculator > sum = table_type::sine( terms - 2 );
+
+            for( unsigned i = terms - 2; i > 0; i -= 1 )
+            {
+                sum = sum * x2 + table_type::sine( i - 1 );
+            }
+
+            return x + x * x2 * sum;
+        }
+
+        // COSINE SERIES ------------------------------------------------------
+
+        /*  Sums the first [terms] terms of the polynomial for cosine, on
+         *  [x2] = x^2.
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const cosineSeries
+        (
+            fract< Calculator > const & x2,
+            unsigned const terms
+        )
+        {
+            typedef Table< Calculator > table_type;
+
+            DEBUG_CODE( assert( terms > 0 &&
+                                terms <= table_type::termCount + 1 ) );
+
+            fract< Calculator > const one( 1, true );
+
+            if( terms == 1 )
+            {
+                return one;
+            }
+
+            fract< Calculator > sum = table_type::cosine( terms - 2 );
+
+            for( unsigned i = terms - 2; i > 0; i -= 1 )
+            {
+                sum = sum * x2 + table_type::cosine( i - 1 );
+            }
+
+            return one + x2 * sum;
+        }
+
+        // SINE ---------------------------------------------------------------
+
+        /*  Returns the magnitude of the sine of [x], summing every term in
+         *  [Table].
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const sin( fract< Calculator > const & x )
+        {
+            unsigned const terms = Table< Calculator >::termCount + 1;
+            bool swapped = false;
+
+            fract< Calculator > const nx = reduce( x, swapped );
+            fract< Calculator > const x2 = nx * nx;
+            fract< Calculator > sum = swapped ? cosineSeries( x2, terms )
+                                              : sineSeries( nx, x2, terms );
+
+            sum.makePositive();
+
+            return sum;
+        }
+
+        // COSINE -------------------------------------------------------------
+
+        /*  Returns the magnitude of the cosine of [x], summing every term in
+         *  [Table].
+         */
+
+        template< class Calculator >
+        static fract< Calculator > const cos( fract< Calculator > const & x )
+        {
+            unsigned const terms = Table< Calculator >::termCount + 1;
+            bool swapped = false;
+
+            fract< Calculator > const nx = reduce( x, swapped );
+            fract< Calculator > const x2 = nx * nx;
+            fract< Calculator > sum = swapped ? sineSeries( nx, x2, terms )
+                                              : cosineSeries( x2, terms );
+
+            sum.makePositive();
+
+            return sum;
+        }
+
+        // SINE AND COSINE ----------------------------------------------------
+
+        /*  Sets [sine] and [cosine] as [sin] and [cos] would, sharing one
+         *  range reduction and one x^2 between the two series.
+         */
+
+        template< class Calculator >
+        static void sincos( fract< Calculator > const & x,
+                            fract< Calculator > & sine,
+                            fract< Calculator > & cosine )
+        {
+            unsigned const terms = Table< Calculator >::termCount + 1;
+            bool swapped = false;
+
+            fract< Calculator > const nx = reduce( x, swapped );
+            fract< Calculator > const x2 = nx * nx;
+
+            sine = sineSeries( nx, x2, terms );
+            sine.makePositive();
+
+            cosine = cosineSeries( x2, terms );
+            cosine.makePositive();
+
+            if( swapped )
+            {
+                std::swap( sine, cosine );
+            }
+        }
+
+        // TANGENT ------------------------------------------------------------
+
+        template< class Calculator >
+        static fract< Calculator > const tan( fract< Calculator > const & x )
+        {
+            fract< Calculator > sine;
+            fract< Calculator > cosine;
+
+            sincos( x, sine, cosine );
+
+            return sine / cosine;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // TRIG BACKEND TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    typedef TrigBackend< TaylorTable, false > TaylorTrig;
+    typedef TrigBackend< MinimaxTable, true > MinimaxTrig;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // TRIG TRAITS CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Names the backend used by the free trig functions. Calculators may
+     *  specialise this class to choose another.
+     */
+
+    template< class Calculator >
+    class TrigTraits
+    {
+        public:
+
+        typedef TaylorTrig backend_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // TRIG_BACKEND_H
@@ -5,8 +5,10 @@
 // INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+#include <type_traits>
 #include <cstdint>
 
+#include "FractComparator.h"
 #include "debug.h"
 #include "fract.h"
 
@@ -24,287 +26,181 @@ namespace fract
     class fract;
     
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // UNSAFE FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++++++++++++
+    // BASIC UNSAFE FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++++++
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Performs arithmetic on components of [IntType] without any overflow
+     *  checks; results that do not fit wrap. [IntType] must be a builtin
+     *  unsigned type no narrower than [unsigned int], so that products are
+     *  not promoted to signed arithmetic.
+     */
     
-    class UnsafeFractCalculator
+    template< class IntType >
+    class BasicUnsafeFractCalculator
     {
+        static_assert( std::is_unsigned< IntType >::value &&
+                       sizeof( IntType ) >= sizeof( unsigned int ),
+                       "components must not promote to int" );
+
         public:
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
             
-        typedef std::uint64_t int_type;
+        typedef IntType int_type;
 
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
             
         // ADD ----------------------------------------------------------------
-            
+
         template< class Calc1, class Calc2 >
-        static fract< Calc1 > const add( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
-            // Copy fractions and equalise them
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
 
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            equalise( clhs, crhs );
-            
-            // Get numerators
+            // Get denominators
 
-            int_type lNumer = clhs.getNumerator();
-            int_type rNumer = crhs.getNumerator();
+            int_type const lDenom = lhs.getDenominator();
+            int_type const rDenom = rhs.getDenominator();
+
+            // Scale numerators to the least common multiple of denominators
+
+            int_type const divisor = gcd( lDenom, rDenom );
+            int_type const lScale = rDenom / divisor;
+            int_type const rScale = lDenom / divisor;
+
+            int_type const lNumer = lhs.getNumerator() * lScale;
+            int_type const rNumer = rhs.getNumerator() * rScale;
 
             // Use signs to determine process
 
-            if( clhs.isPositive() == crhs.isPositive() )
+            int_type numer = 0;
+            bool positive = lhs.isPositive();
+
+            if( lhs.isPositive() == rhs.isPositive() )
             {
-                lNumer += rNumer;
+                numer = lNumer + rNumer;
             }
             else
             {
                 if( lNumer > rNumer )
                 {
-                    lNumer -= rNumer;
+                    numer = lNumer - rNumer;
                 }
                 else
                 {
-                    lNumer = rNumer - lNumer;
-                    clhs.negate();
+                    numer = rNumer - lNumer;
+                    positive = rhs.isPositive();
                 }
             }
 
-            // Return result
+            // Check for zero numerator
+
+            if( numer == 0 )
+            {
+                return fract< Calc1 >( 0, true );
+            }
+
+            // Remove any part of the common factor shared with the numerator
+
+            int_type const common =
+                ( divisor == 1 ) ? 1 : gcd( numer, divisor );
+            int_type const denom = rScale * ( rDenom / common );
 
-            return fract< Calc1 >( lNumer,
-                                   clhs.getDenominator(),
-                                   clhs.isPositive() );
+            return fract< Calc1 >::fromReduced
+            (
+                numer / common,
+                storableDenominator< Calc1 >( denom ),
+                positive
+            );
         }
             
         // MUL ----------------------------------------------------------------
-            
+
         template< class Calc1, class Calc2 >
-        static fract< Calc1 > const mul( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
             DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
                                 rhs.getDenominator() > 0 ) );
 
-            // Determine sign of result
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     rhs.getDenominator(),
+                                     lhs.isPositive() == rhs.isPositive() );
+        }
 
-            bool positive = true;
+        // DIV ----------------------------------------------------------------
 
-            if( lhs.isPositive() == rhs.isPositive() )
-            {
-                positive = true;
-            }
-            else
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
             {
-                positive = false;
+                return fract< Calc1 >( 0, true );
             }
 
-            // Return result of component multiplication
-
-            return fract< Calc1 >( lhs.getNumerator() * rhs.getNumerator(),
-                                   lhs.getDenominator() * rhs.getDenominator(),
-                                   positive );
+            return product< Calc1 >( lhs.getNumerator(),
+                                     lhs.getDenominator(),
+                                     rhs.getDenominator(),
+                                     rhs.getNumerator(),
+                                     lhs.isPositive() == rhs.isPositive() );
         }
         
         // ARE EQUAL ----------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const areEqual( fract< Calc1 > const & lhs,
-                                    fract< Calc2 > const & rhs )
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
         {
-            // Compare signs
-            
-            if( lhs.isPositive() != rhs.isPositive() )
-            {
-                return false;
-            }
-            
-            // Copy fractions and equalise
-            
-            fract< Calc1 > clhs( lhs );
-            fract< Calc2 > crhs( rhs );
-            
-            equalise( clhs, crhs );
-            
-            // Compare numerators
-            
-            return clhs.getNumerator() == crhs.getNumerator();
+            return FractComparator::compare( lhs, rhs ) == 0;
         }
         
         // IS LESS ------------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isLess( fract< Calc1 > const & lhs,
-                                  fract< Calc2 > const & rhs )
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
         {
-            // Compare signs
-            
-            if( lhs.isPositive() )
-            {
-                if( rhs.isNegative() )
-                {
-                    return false;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() < crhs.getNumerator();
-            }
-            else
-            {
-                if( rhs.isPositive() )
-                {
-                    return true;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() > crhs.getNumerator();
-            }
+            return FractComparator::compare( lhs, rhs ) < 0;
         }
         
         // IS LESS OR EQUAL ---------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isLessOrEqual( fract< Calc1 > const & lhs,
-                                         fract< Calc2 > const & rhs )
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
         {
-            // Compare signs
-            
-            if( lhs.isPositive() )
-            {
-                if( rhs.isNegative() )
-                {
-                    return false;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() <= crhs.getNumerator();
-            }
-            else
-            {
-                if( rhs.isPositive() )
-                {
-                    return true;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() >= crhs.getNumerator();
-            }
+            return FractComparator::compare( lhs, rhs ) <= 0;
         }
         
         // IS GREATER ---------------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isGreater( fract< Calc1 > const & lhs,
-                                     fract< Calc2 > const & rhs )
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
         {
-            // Compare signs
-            
-            if( lhs.isPositive() )
-            {
-                if( rhs.isNegative() )
-                {
-                    return true;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() > crhs.getNumerator();
-            }
-            else
-            {
-                if( rhs.isPositive() )
-                {
-                    return false;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() < crhs.getNumerator();
-            }
+            return FractComparator::compare( lhs, rhs ) > 0;
         }
         
         // IS GREATER OR EQUAL ------------------------------------------------
         
         template< class Calc1, class Calc2 >
-        static bool const isGreaterOrEqual( fract< Calc1 > const & lhs,
-                                            fract< Calc2 > const & rhs )
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
         {
-            // Compare signs
-            
-            if( lhs.isPositive() )
-            {
-                if( rhs.isNegative() )
-                {
-                    return true;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() >= crhs.getNumerator();
-            }
-            else
-            {
-                if( rhs.isPositive() )
-                {
-                    return false;
-                }
-                
-                // Copy fractions, equalise, and compare
-            
-                fract< Calc1 > clhs( lhs );
-                fract< Calc2 > crhs( rhs );
-
-                equalise( clhs, crhs );
-                
-                return clhs.getNumerator() <= crhs.getNumerator();
-            }
+            return FractComparator::compare( lhs, rhs ) >= 0;
         }
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -318,9 +214,9 @@ namespace fract
          *  http://qin.laya.com/tech_projects_approxpi.html
          */
         
-        static fract< UnsafeFractCalculator > const PI;
-        static fract< UnsafeFractCalculator > const TWO_PI;
-        static fract< UnsafeFractCalculator > const HALF_PI;
+        static fract< BasicUnsafeFractCalculator > const PI;
+        static fract< BasicUnsafeFractCalculator > const TWO_PI;
+        static fract< BasicUnsafeFractCalculator > const HALF_PI;
         
         // EULER'S CONSTANT ---------------------------------------------------
         
@@ -330,57 +226,63 @@ namespace fract
          *  e = sum( 1 / n! ) [0 <= n < infinity]
          */
         
-        static fract< UnsafeFractCalculator > const E;
+        static fract< BasicUnsafeFractCalculator > const E;
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        
+
         private:
-        
+
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        
-        // EQUALISE -----------------------------------------------------------
-            
-        template< class Calc1, class Calc2 >
-        static void equalise( fract< Calc1 > & lhs, fract< Calc2 > & rhs )
+
+        // PRODUCT ------------------------------------------------------------
+
+        template< class Calc >
+        static constexpr fract< Calc > const product( int_type const lNumer,
+                                                      int_type const lDenom,
+                                                      int_type const rNumer,
+                                                      int_type const rDenom,
+                                                      bool const positive )
         {
-            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
-                                rhs.getDenominator() > 0 ) );
+            // Check for zero numerators
 
-            // Get fraction components
+            if( lNumer == 0 || rNumer == 0 )
+            {
+                return fract< Calc >( 0, true );
+            }
 
-            int_type lNumer = lhs.getNumerator();
-            int_type lDenom = lhs.getDenominator();
-            int_type rNumer = rhs.getNumerator();
-            int_type rDenom = rhs.getDenominator();
-            
-            // Compute least common multiple of denominators
+            // Cancel common factors across the operands
 
-            int_type lcm = ( lDenom / gcd( lDenom, rDenom ) ) * rDenom;
-            
-            // Equalise LHS
+            int_type const lCommon = gcd( lNumer, rDenom );
+            int_type const rCommon = gcd( rNumer, lDenom );
 
-            int_type mul = lcm / lDenom;
+            int_type const denom = ( lDenom / rCommon ) * ( rDenom / lCommon );
 
-            lNumer *= mul;
-            lDenom *= mul;
+            return fract< Calc >::fromReduced
+            (
+                ( lNumer / lCommon ) * ( rNumer / rCommon ),
+                storableDenominator< Calc >( denom ),
+                positive
+            );
+        }
 
-            // Equalise RHS
+        // STORABLE DENOMINATOR -----------------------------------------------
 
-            mul = lcm / rDenom;
+        /*  Wraps an overflowing denominator to the storage of [Calc], whose
+         *  [maxDenominator] is all ones, and makes a wrapped zero one. The
+         *  packed layout would otherwise drop the top bit itself, after the
+         *  zero check, and store 2^63 as zero.
+         */
 
-            rNumer *= mul;
-            
-            // Set fraction components
-            
-            lhs.setNumerator( lNumer );
-            lhs.setDenominator( lDenom );
-            
-            rhs.setNumerator( rNumer );
-            rhs.setDenominator( lDenom );
+        template< class Calc >
+        static constexpr int_type const storableDenominator( int_type denom )
+        {
+            denom &= fract< Calc >::storage_type::maxDenominator();
+
+            return ( denom == 0 ) ? 1 : denom;
         }
-            
+
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     };
     
@@ -390,25 +292,41 @@ namespace fract
     
     // PI ---------------------------------------------------------------------
     
-    fract< UnsafeFractCalculator > const
-    UnsafeFractCalculator::PI =
-    fract< UnsafeFractCalculator >( 311, 99, true );
+    template< class IntType >
+    constexpr fract< BasicUnsafeFractCalculator< IntType > > const
+    BasicUnsafeFractCalculator< IntType >::PI =
+    fract< BasicUnsafeFractCalculator< IntType > >( 311, 99, true );
     
-    fract< UnsafeFractCalculator > const
-    UnsafeFractCalculator::TWO_PI =
-    UnsafeFractCalculator::PI *
-    fract< UnsafeFractCalculator >( 2, true );
+    template< class IntType >
+    constexpr fract< BasicUnsafeFractCalculator< IntType > > const
+    BasicUnsafeFractCalculator< IntType >::TWO_PI =
+    BasicUnsafeFractCalculator< IntType >::PI *
+    fract< BasicUnsafeFractCalculator< IntType > >( 2, true );
     
-    fract< UnsafeFractCalculator > const
-    UnsafeFractCalculator::HALF_PI = 
-    UnsafeFractCalculator::PI /
-    fract< UnsafeFractCalculator >( 2, true );
+    template< class IntType >
+    constexpr fract< BasicUnsafeFractCalculator< IntType > > const
+    BasicUnsafeFractCalculator< IntType >::HALF_PI = 
+    BasicUnsafeFractCalculator< IntType >::PI /
+    fract< BasicUnsafeFractCalculator< IntType > >( 2, true );
     
     // EULER'S CONSTANT -------------------------------------------------------
     
-    fract< UnsafeFractCalculator > const
-    UnsafeFractCalculator::E = 
-    fract< UnsafeFractCalculator >( 685, 252, true );
+    template< class IntType >
+    constexpr fract< BasicUnsafeFractCalculator< IntType > > const
+    BasicUnsafeFractCalculator< IntType >::E = 
+    fract< BasicUnsafeFractCalculator< IntType > >( 685, 252, true );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // UNSAFE FRACT CALCULATORS +++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  [UnsafeFractCalculator] keeps its 64-bit components. The 32-bit
+     *  variant halves the size of a fraction and uses cheaper division.
+     */
+
+    typedef BasicUnsafeFractCalculator< std::uint64_t > UnsafeFractCalculator;
+    typedef BasicUnsafeFractCalculator< std::uint32_t >
+        Unsafe32FractCalculator;
     
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 }
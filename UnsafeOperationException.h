@@ -0,0 +1,45 @@
+#ifndef UNSAFE_OPERATION_EXCEPTION_H
+#define UNSAFE_OPERATION_EXCEPTION_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <exception>
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // UNSAFE OPERATION CLASS +++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    
+    class UnsafeOperationException : public std::exception
+    {
+        public:
+        
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        
+        // WHAT ---------------------------------------------------------------
+            
+        virtual char const * what( void ) const throw()
+        {
+            return "Unsafe operation detected";
+        }
+            
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    }
+    
+    UnsafeOperation;
+    
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // UNSAFE_OPERATION_EXCEPTION_H
@@ -0,0 +1,496 @@
+#ifndef WIDE_FRACT_CALCULATOR_H
+#define WIDE_FRACT_CALCULATOR_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+#include <limits>
+
+#include "WideIntegerTraits.h"
+#include "FractComparator.h"
+#include "ErrorPolicy.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FORWARD DECLARATIONS +++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    template< class Calculator >
+    class fract;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // WIDE PI CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Components of the [PI] of each width, the largest convergent of pi
+     *  whose numerator can be doubled without overflow.
+     */
+
+    template< class IntType >
+    class WidePi;
+
+    template<>
+    class WidePi< std::uint16_t >
+    {
+        public:
+
+        static constexpr std::uint16_t numerator( void ) { return 355; }
+        static constexpr std::uint16_t denominator( void ) { return 113; }
+    };
+
+    template<>
+    class WidePi< std::uint32_t >
+    {
+        public:
+
+        static constexpr std::uint32_t numerator( void )
+        {
+            return 1068966896;
+        }
+
+        static constexpr std::uint32_t denominator( void )
+        {
+            return 340262731;
+        }
+    };
+
+    template<>
+    class WidePi< std::uint64_t >
+    {
+        public:
+
+        static constexpr std::uint64_t numerator( void )
+        {
+            return 2646693125139304345u;
+        }
+
+        static constexpr std::uint64_t denominator( void )
+        {
+            return 842468587426513207u;
+        }
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // BASIC WIDE FRACT CALCULATOR CLASS ++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Performs exact arithmetic on fractions with components of [IntType]
+     *  by carrying out every intermediate step in the unsigned type of twice
+     *  the width. Results are reduced before being narrowed back, so an
+     *  operation only fails when the reduced result cannot be represented.
+     *  Failure is handled by [ErrorPolicy], which by default throws
+     *  [UnsafeOperationException]; [StickyFlagErrorPolicy] returns zero and
+     *  raises a flag to be checked once per batch instead. The [try]
+     *  methods report failure by return value whatever the policy, so a
+     *  caller can repeat the operation on wider components, see
+     *  [fract_cast].
+     *
+     *  Operands are expected to be in lowest terms, which every fract
+     *  constructor and operator guarantees.
+     */
+
+    template< class IntType, class ErrorPolicy = ThrowingErrorPolicy >
+    class BasicWideFractCalculator
+    {
+        static_assert( WideIntegerTraits< IntType >::hasWideType &&
+                       sizeof( IntType ) >= 2,
+                       "components need a builtin type of twice the width" );
+
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef IntType int_type;
+        typedef typename WideIntegerTraits< IntType >::wide_type wide_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // ADD ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const add( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( !( tryAdd( lhs, rhs, result ) ) )
+            {
+                return ErrorPolicy::template fail< Calc1 >();
+            }
+
+            return result;
+        }
+
+        // MUL ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const mul( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( !( tryMul( lhs, rhs, result ) ) )
+            {
+                return ErrorPolicy::template fail< Calc1 >();
+            }
+
+            return result;
+        }
+
+        // DIV ----------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr fract< Calc1 > const div( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            fract< Calc1 > result;
+
+            if( !( tryDiv( lhs, rhs, result ) ) )
+            {
+                return ErrorPolicy::template fail< Calc1 >();
+            }
+
+            return result;
+        }
+
+        // TRY ADD ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const tryAdd( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs,
+                                            fract< Calc1 > & result )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            // Get fraction components
+
+            int_type const lDenom = lhs.getDenominator();
+            int_type const rDenom = rhs.getDenominator();
+
+            // Scale numerators to the least common multiple of denominators
+
+            int_type const divisor = gcd( lDenom, rDenom );
+            int_type const lScale = rDenom / divisor;
+            int_type const rScale = lDenom / divisor;
+
+            wide_type const lNumer = ( wide_type )lhs.getNumerator() * lScale;
+            wide_type const rNumer = ( wide_type )rhs.getNumerator() * rScale;
+            wide_type denom = ( wide_type )lDenom * lScale;
+
+            // Use signs to determine process
+
+            wide_type numer = 0;
+            bool positive = lhs.isPositive();
+
+            if( lhs.isPositive() == rhs.isPositive() )
+            {
+                numer = lNumer + rNumer;
+
+                // A carry out of the wide type can only be cancelled by a
+                // factor of [divisor], which leaves a result that is still
+                // too wide
+
+                if( numer < lNumer )
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if( lNumer > rNumer )
+                {
+                    numer = lNumer - rNumer;
+                }
+                else
+                {
+                    numer = rNumer - lNumer;
+                    positive = rhs.isPositive();
+                }
+            }
+
+            // Check for zero numerator
+
+            if( numer == 0 )
+            {
+                result = fract< Calc1 >( 0, true );
+                return true;
+            }
+
+            // Only the common factor of the denominators can divide the
+            // numerator, so reduce against it with a narrow GCD
+
+            if( divisor != 1 )
+            {
+                int_type const common =
+                    gcd( ( int_type )( numer % divisor ), divisor );
+
+                numer /= common;
+                denom = ( wide_type )rScale * ( rDenom / common );
+            }
+
+            // Check result fits the storage
+
+            if( ( numer >> intBits ) != 0 ||
+                denom > fract< Calc1 >::storage_type::maxDenominator() )
+            {
+                return false;
+            }
+
+            result = fract< Calc1 >::fromReduced( ( int_type )numer,
+                                                  ( int_type )denom,
+                                                  positive );
+
+            return true;
+        }
+
+        // TRY MUL ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const tryMul( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs,
+                                            fract< Calc1 > & result )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            return tryProduct( lhs.getNumerator(),
+                               lhs.getDenominator(),
+                               rhs.getNumerator(),
+                               rhs.getDenominator(),
+                               lhs.isPositive() == rhs.isPositive(),
+                               result );
+        }
+
+        // TRY DIV ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const tryDiv( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs,
+                                            fract< Calc1 > & result )
+        {
+            DEBUG_CODE( assert( lhs.getDenominator() > 0 &&
+                                rhs.getDenominator() > 0 ) );
+
+            if( rhs.isZero() )
+            {
+                result = fract< Calc1 >( 0, true );
+                return true;
+            }
+
+            return tryProduct( lhs.getNumerator(),
+                               lhs.getDenominator(),
+                               rhs.getDenominator(),
+                               rhs.getNumerator(),
+                               lhs.isPositive() == rhs.isPositive(),
+                               result );
+        }
+
+        // ARE EQUAL ----------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const areEqual( fract< Calc1 > const & lhs,
+                                              fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) == 0;
+        }
+
+        // IS LESS ------------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLess( fract< Calc1 > const & lhs,
+                                            fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) < 0;
+        }
+
+        // IS LESS OR EQUAL ---------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isLessOrEqual( fract< Calc1 > const & lhs,
+                                                   fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) <= 0;
+        }
+
+        // IS GREATER ---------------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const isGreater( fract< Calc1 > const & lhs,
+                                               fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) > 0;
+        }
+
+        // IS GREATER OR EQUAL ------------------------------------------------
+
+        template< class Calc1, class Calc2 >
+        static constexpr bool const
+        isGreaterOrEqual( fract< Calc1 > const & lhs,
+                          fract< Calc2 > const & rhs )
+        {
+            return FractComparator::compare( lhs, rhs ) >= 0;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC DATA ++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // PI -----------------------------------------------------------------
+
+        /*  The constant [PI] is initialised to a convergent of pi that fits
+         *  the components with room for [TWO_PI]. For 64-bit components
+         *  this is 2646693125139304345/842468587426513207, which is accurate
+         *  to 37 decimal places. This and similar fractions can be found at:
+         *  http://qin.laya.com/tech_projects_approxpi.html
+         */
+
+        static fract< BasicWideFractCalculator > const PI;
+        static fract< BasicWideFractCalculator > const TWO_PI;
+        static fract< BasicWideFractCalculator > const HALF_PI;
+
+        // EULER'S CONSTANT ---------------------------------------------------
+
+        /*  The constant [E] is initialised to 685/252, which is accurate to 4
+         *  decimal places. This fraction was calculated as a sum of the
+         *  infinite series:
+         *  e = sum( 1 / n! ) [0 <= n < infinity]
+         */
+
+        static fract< BasicWideFractCalculator > const E;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE METHODS ++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // TRY PRODUCT --------------------------------------------------------
+
+        template< class Calc >
+        static constexpr bool const tryProduct( int_type const lNumer,
+                                                int_type const lDenom,
+                                                int_type const rNumer,
+                                                int_type const rDenom,
+                                                bool const positive,
+                                                fract< Calc > & result )
+        {
+            // Check for zero numerators
+
+            if( lNumer == 0 || rNumer == 0 )
+            {
+                result = fract< Calc >( 0, true );
+                return true;
+            }
+
+            // Cancel common factors across the operands
+
+            int_type const lCommon = gcd( lNumer, rDenom );
+            int_type const rCommon = gcd( rNumer, lDenom );
+
+            wide_type const numer =
+                ( wide_type )( lNumer / lCommon ) * ( rNumer / rCommon );
+
+            wide_type const denom =
+                ( wide_type )( lDenom / rCommon ) * ( rDenom / lCommon );
+
+            // Check result fits the storage
+
+            if( ( numer >> intBits ) != 0 ||
+                denom > fract< Calc >::storage_type::maxDenominator() )
+            {
+                return false;
+            }
+
+            result = fract< Calc >::fromReduced( ( int_type )numer,
+                                                 ( int_type )denom,
+                                                 positive );
+
+            return true;
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // INTEGER BITS -------------------------------------------------------
+
+        static constexpr unsigned const intBits =
+            std::numeric_limits< int_type >::digits;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // PI ---------------------------------------------------------------------
+
+    /*  [TWO_PI] and [HALF_PI] are defined ahead of [PI], since defining
+     *  [PI] instantiates fract and with it the references to the other
+     *  constants.
+     */
+
+    template< class IntType, class ErrorPolicy >
+    constexpr fract< BasicWideFractCalculator< IntType, ErrorPolicy > > const
+    BasicWideFractCalculator< IntType, ErrorPolicy >::TWO_PI =
+    BasicWideFractCalculator< IntType, ErrorPolicy >::PI *
+    fract< BasicWideFractCalculator< IntType, ErrorPolicy > >( 2, true );
+
+    template< class IntType, class ErrorPolicy >
+    constexpr fract< BasicWideFractCalculator< IntType, ErrorPolicy > > const
+    BasicWideFractCalculator< IntType, ErrorPolicy >::HALF_PI =
+    BasicWideFractCalculator< IntType, ErrorPolicy >::PI /
+    fract< BasicWideFractCalculator< IntType, ErrorPolicy > >( 2, true );
+
+    template< class IntType, class ErrorPolicy >
+    constexpr fract< BasicWideFractCalculator< IntType, ErrorPolicy > > const
+    BasicWideFractCalculator< IntType, ErrorPolicy >::PI =
+    fract< BasicWideFractCalculator< IntType, ErrorPolicy > >
+    (
+        WidePi< IntType >::numerator(),
+        WidePi< IntType >::denominator(),
+        true
+    );
+
+    // EULER'S CONSTANT -------------------------------------------------------
+
+    template< class IntType, class ErrorPolicy >
+    constexpr fract< BasicWideFractCalculator< IntType, ErrorPolicy > > const
+    BasicWideFractCalculator< IntType, ErrorPolicy >::E =
+    fract< BasicWideFractCalculator< IntType, ErrorPolicy > >( 685, 252, true );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // WIDE FRACT CALCULATORS +++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Named after the width of their intermediates. 16-bit and 32-bit
+     *  components fit four or two times as many fractions per cache line
+     *  as 64-bit ones, and their arithmetic needs no 128-bit support.
+     */
+
+    typedef BasicWideFractCalculator< std::uint16_t > Int32FractCalculator;
+    typedef BasicWideFractCalculator< std::uint32_t > Int64FractCalculator;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // WIDE_FRACT_CALCULATOR_H
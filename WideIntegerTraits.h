@@ -0,0 +1,128 @@
+#ifndef WIDE_INTEGER_TRAITS_H
+#define WIDE_INTEGER_TRAITS_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // UNSIGNED OF SIZE CLASS +++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Maps a size in bytes onto the builtin unsigned type of that size, if
+     *  there is one.
+     */
+
+    template< std::size_t Bytes >
+    class UnsignedOfSize
+    {
+        public:
+
+        static bool const exists = false;
+        typedef void type;
+    };
+
+    template<>
+    class UnsignedOfSize< 2 >
+    {
+        public:
+
+        static bool const exists = true;
+        typedef std::uint16_t type;
+    };
+
+    template<>
+    class UnsignedOfSize< 4 >
+    {
+        public:
+
+        static bool const exists = true;
+        typedef std::uint32_t type;
+    };
+
+    template<>
+    class UnsignedOfSize< 8 >
+    {
+        public:
+
+        static bool const exists = true;
+        typedef std::uint64_t type;
+    };
+
+    #if defined( __SIZEOF_INT128__ )
+
+    template<>
+    class UnsignedOfSize< 16 >
+    {
+        public:
+
+        static bool const exists = true;
+        typedef unsigned __int128 type;
+    };
+
+    #endif
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // WIDE INTEGER TRAITS CLASS ++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  Describes the type used to hold the full product of two values of
+     *  [IntType]. For builtin unsigned types this is the unsigned type of
+     *  twice the size, where one exists. [hasWideType] is false when no such
+     *  type is available, in which case [wide_type] is [IntType] itself and
+     *  must not be used for products.
+     *
+     *  Integer types defined elsewhere may specialise this class; a type
+     *  that cannot overflow should name itself as its own wide type.
+     */
+
+    template
+    <
+        class IntType,
+        bool IsBuiltin = std::is_integral< IntType >::value &&
+                         std::is_unsigned< IntType >::value
+    >
+    class WideIntegerTraits
+    {
+        public:
+
+        static bool const hasWideType = false;
+        typedef IntType wide_type;
+    };
+
+    template< class IntType >
+    class WideIntegerTraits< IntType, true >
+    {
+        private:
+
+        typedef UnsignedOfSize< 2 * sizeof( IntType ) > wide_size;
+
+        public:
+
+        static bool const hasWideType = wide_size::exists;
+
+        typedef typename std::conditional
+        <
+            wide_size::exists,
+            typename wide_size::type,
+            IntType
+        >
+        ::type wide_type;
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // WIDE_INTEGER_TRAITS_H
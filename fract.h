@@ -5,12 +5,21 @@
 // INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+#include <type_traits>
+#include <algorithm>
 #include <iostream>
 #include <cassert>
 #include <cstdint>
+#include <utility>
 #include <limits>
 #include <cmath>
 
+#include "UnsafeOperationException.h"
+#include "FractComparator.h"
+#include "FractStorage.h"
+#include "TrigBackend.h"
+#include "CordicTrig.h"
+#include "GcdEngine.h"
 #include "debug.h"
 
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -32,192 +41,654 @@ namespace fract
 
     // GREATEST COMMON DIVISOR ------------------------------------------------
     
+    /*  Dispatches to the engine selected for the integer type, see
+     *  [GcdEngine.h]. Builtin unsigned types of up to 32 bits use the
+     *  binary algorithm, and wider types Euclid's.
+     */
+
     template< class IntType >
-    IntType const gcd( IntType a, IntType b )
+    constexpr IntType const gcd( IntType a, IntType b )
     {
-        for( ;; )
-        {
-            if( a == 0 )
-            {
-                return b;
-            }
-
-            b %= a;
-
-            if( b == 0 )
-            {
-                return a;
-            }
-
-            a %= b;
-        }
+        return GcdEngine< IntType >::gcd( a, b );
     }
     
     // MODULO -----------------------------------------------------------------
     
+    /*  Returns the remainder of [x] after taking out as many whole [y] as
+     *  fit, with the sign of [x] as std::fmod gives. The whole count is the
+     *  integer part of the quotient, so this is exact whenever [Calc1]'s
+     *  arithmetic is.
+     */
+
     template< class Calc1, class Calc2 >
     fract< Calc1 > const mod( fract< Calc1 > const & x,
                               fract< Calc2 > const & y )
     {
-        return fract< Calc1 >( std::fmod( x.toLongDouble(),
-                                          y.toLongDouble() ) );
+        typedef typename fract< Calc1 >::int_type int_type;
+
+        DEBUG_CODE( assert( !y.isZero() ) );
+
+        fract< Calc1 > nx( x );
+        fract< Calc1 > ny( y );
+
+        nx.makePositive();
+        ny.makePositive();
+
+        if( nx < ny )
+        {
+            return x;
+        }
+
+        fract< Calc1 > const quotient = nx / ny;
+        int_type const whole =
+            quotient.getNumerator() / quotient.getDenominator();
+
+        nx -= ny * fract< Calc1 >( whole, true );
+
+        if( !x.isPositive() && !nx.isZero() )
+        {
+            nx.negate();
+        }
+
+        return nx;
     }
     
-    // SINE -------------------------------------------------------------------
-    
+    // REDUCE ANGLE -----------------------------------------------------------
+
+    /*  Returns the magnitude of [x] less whole quarter turns, in
+     *  [ 0, HALF_PI ), and sets [quadrant] to the number taken out modulo
+     *  four, see [RangeReduction]. In odd quadrants the magnitude of sine
+     *  is that of the cosine of the remainder and vice versa.
+     */
+
     template< class Calculator >
-    fract< Calculator > const sin( fract< Calculator > const & x )
+    fract< Calculator > const reduceAngle( fract< Calculator > const & x,
+                                           unsigned & quadrant )
     {
-        // Ensure x <= HALF_PI ( 90 degrees )
-        
-        fract< Calculator > nx( x );
-        nx.makePositive();
-        
-        if( nx > fract< Calculator >::HALF_PI )
+        return RangeReduction< Calculator >::reduce( x, quadrant );
+    }
+
+    // SERIES TERM COUNT ------------------------------------------------------
+
+    /*  Returns how many leading terms of the sine series ( [odd] ) or the
+     *  cosine series of a reduced angle [x] are needed for the first
+     *  omitted term to fall below [tolerance], from one up to all those in
+     *  [TaylorTable]. On [ 0, HALF_PI ] the terms alternate in sign and
+     *  shrink, so the first omitted term bounds the error. Term sizes are
+     *  only estimated, in long double, which costs far less than a term.
+     */
+
+    template< class Calculator >
+    unsigned const seriesTermCount( fract< Calculator > const & x,
+                                    fract< Calculator > const & tolerance,
+                                    bool const odd )
+    {
+        unsigned const maxTerms = TaylorTable< Calculator >::termCount + 1;
+
+        long double const bound = std::fabs( tolerance.toLongDouble() );
+        long double const square = x.toLongDouble() * x.toLongDouble();
+
+        long double term = odd ? x.toLongDouble() : 1.0l;
+        unsigned power = odd ? 1 : 0;
+        unsigned terms = 1;
+
+        for( ; terms < maxTerms; terms += 1 )
         {
-            nx = mod( nx, fract< Calculator >::HALF_PI );
+            term *= square / ( ( power + 1 ) * ( power + 2 ) );
+            power += 2;
+
+            if( term < bound )
+            {
+                break;
+            }
         }
-        
-        // Calculate sine of x using Taylor Expansion
 
-        fract< Calculator > const one( 1, true );
-        fract< Calculator > sign( 1, false );
-        fract< Calculator > fact = one;
-        fract< Calculator > fnum = one;
-        fract< Calculator > px = nx;
+        return terms;
+    }
 
-        fract< Calculator > sum = nx;
-        
-        for( unsigned i = 0; i < 9; i += 1 )
-        {
-            // Calculate factorial
-            
-            fnum += one;
-            fact *= fnum;
-            fnum += one;
-            fact *= fnum;
+    // SINE -------------------------------------------------------------------
 
-            // Calculate power
-            
-            px *= nx;
-            px *= nx;
+    /*  Returns the magnitude of the sine of [x], using the backend named
+     *  by [TrigTraits], see [TrigBackend].
+     */
 
-            // Add term to sum
-            
-            sum += sign * ( px / fact );
-            
-            // Flip sign
+    template< class Calculator >
+    fract< Calculator > const sin( fract< Calculator > const & x )
+    {
+        return TrigTraits< Calculator >::backend_type::sin( x );
+    }
 
-            sign.negate();
-        }
+    /*  As above, but sums the Taylor series only until the remaining terms
+     *  fall below [tolerance], setting [terms] to the number of terms
+     *  summed.
+     */
+
+    template< class Calculator >
+    fract< Calculator > const sin( fract< Calculator > const & x,
+                                   fract< Calculator > const & tolerance,
+                                   unsigned & terms )
+    {
+        unsigned quadrant = 0;
+
+        fract< Calculator > const nx = reduceAngle( x, quadrant );
 
-        // Ensure sign is positive
+        // Sine's own series is the odd one outside odd quadrants
+
+        bool const odd = ( quadrant & 1 ) == 0;
+
+        terms = seriesTermCount( nx, tolerance, odd );
+
+        fract< Calculator > const x2 = nx * nx;
+        fract< Calculator > sum = odd
+                                  ? TaylorTrig::sineSeries( nx, x2, terms )
+                                  : TaylorTrig::cosineSeries( x2, terms );
 
         sum.makePositive();
-        
-        // Return result
-        
+
         return sum;
     }
 
+    template< class Calculator >
+    fract< Calculator > const sin( fract< Calculator > const & x,
+                                   fract< Calculator > const & tolerance )
+    {
+        unsigned terms = 0;
+
+        return sin( x, tolerance, terms );
+    }
+
     // COSINE -----------------------------------------------------------------
-    
+
+    /*  Returns the magnitude of the cosine of [x], using the backend named
+     *  by [TrigTraits].
+     */
+
     template< class Calculator >
     fract< Calculator > const cos( fract< Calculator > const & x )
     {
-        // Ensure x <= HALF_PI ( 90 degrees )
+        return TrigTraits< Calculator >::backend_type::cos( x );
+    }
 
-        fract< Calculator > nx( x );
-        nx.makePositive();
+    /*  As above, but sums the Taylor series only until the remaining terms
+     *  fall below [tolerance], setting [terms] to the number of terms
+     *  summed.
+     */
+
+    template< class Calculator >
+    fract< Calculator > const cos( fract< Calculator > const & x,
+                                   fract< Calculator > const & tolerance,
+                                   unsigned & terms )
+    {
+        unsigned quadrant = 0;
 
-        if( nx > fract< Calculator >::HALF_PI )
+        fract< Calculator > const nx = reduceAngle( x, quadrant );
+        bool const odd = ( quadrant & 1 ) != 0;
+
+        terms = seriesTermCount( nx, tolerance, odd );
+
+        fract< Calculator > const x2 = nx * nx;
+        fract< Calculator > sum = odd
+                                  ? TaylorTrig::sineSeries( nx, x2, terms )
+                                  : TaylorTrig::cosineSeries( x2, terms );
+
+        sum.makePositive();
+
+        return sum;
+    }
+
+    template< class Calculator >
+    fract< Calculator > const cos( fract< Calculator > const & x,
+                                   fract< Calculator > const & tolerance )
+    {
+        unsigned terms = 0;
+
+        return cos( x, tolerance, terms );
+    }
+
+    // SINE AND COSINE --------------------------------------------------------
+
+    /*  Sets [sine] and [cosine] to the magnitudes of the sine and cosine of
+     *  [x], as [sin] and [cos] would, sharing one range reduction and one
+     *  x^2 between the two series.
+     */
+
+    template< class Calculator >
+    void sincos( fract< Calculator > const & x,
+                 fract< Calculator > & sine,
+                 fract< Calculator > & cosine )
+    {
+        TrigTraits< Calculator >::backend_type::sincos( x, sine, cosine );
+    }
+
+    // TANGENT ----------------------------------------------------------------
+
+    template< class Calculator >
+    fract< Calculator > const tan( fract< Calculator > const & x )
+    {
+        return TrigTraits< Calculator >::backend_type::tan( x );
+    }
+
+    /*  Applies [tolerance] to both Taylor series; [terms] is set to the
+     *  total number of terms summed.
+     */
+
+    template< class Calculator >
+    fract< Calculator > const tan( fract< Calculator > const & x,
+                                   fract< Calculator > const & tolerance,
+                                   unsigned & terms )
+    {
+        unsigned quadrant = 0;
+
+        fract< Calculator > const nx = reduceAngle( x, quadrant );
+        fract< Calculator > const x2 = nx * nx;
+
+        unsigned const sineTerms = seriesTermCount( nx, tolerance, true );
+        unsigned const cosineTerms = seriesTermCount( nx, tolerance, false );
+
+        fract< Calculator > sine =
+            TaylorTrig::sineSeries( nx, x2, sineTerms );
+        fract< Calculator > cosine =
+            TaylorTrig::cosineSeries( x2, cosineTerms );
+
+        sine.makePositive();
+        cosine.makePositive();
+
+        terms = sineTerms + cosineTerms;
+
+        if( quadrant & 1 )
         {
-            nx = mod( nx, fract< Calculator >::HALF_PI );
+            return cosine / sine;
         }
-        
-        // Calculate cosine of x using Taylor Expansion
 
-        fract< Calculator > const one( 1, true );
-        fract< Calculator > sign( 1, false );
-        fract< Calculator > fact = one;
-        fract< Calculator > fnum( 0, true );
-        fract< Calculator > px = one;
+        return sine / cosine;
+    }
+
+    template< class Calculator >
+    fract< Calculator > const tan( fract< Calculator > const & x,
+                                   fract< Calculator > const & tolerance )
+    {
+        unsigned terms = 0;
+
+        return tan( x, tolerance, terms );
+    }
+
+    // INTEGER ROOT -----------------------------------------------------------
 
-        fract< Calculator > sum = one;
+    /*  Returns the largest integer whose [degree]th power does not exceed
+     *  [value], by Newton's method from a power of two above the root.
+     *  Each step divides [value] by the estimate repeatedly rather than
+     *  forming a power of it, so bounded types cannot overflow.
+     */
 
-        for( unsigned i = 0; i < 9; i += 1 )
+    template< class IntType >
+    IntType const integerRoot( IntType const & value, unsigned const degree )
+    {
+        DEBUG_CODE( assert( degree > 0 ) );
+
+        IntType const two( 2 );
+
+        if( degree == 1 || value < two )
         {
-            // Calculate factorial
+            return value;
+        }
 
-            fnum += one;
-            fact *= fnum;
-            fnum += one;
-            fact *= fnum;
+        unsigned bits = 0;
 
-            // Calculate power
+        for( IntType rest( value ); rest > IntType( 0 ); rest /= two )
+        {
+            bits += 1;
+        }
 
-            px *= nx;
-            px *= nx;
+        // Roots below two when the degree reaches the bit count
 
-            // Add term to sum
+        if( degree >= bits )
+        {
+            return IntType( 1 );
+        }
+
+        IntType estimate( 1 );
+
+        for( unsigned i = 0; i < ( bits + degree - 1 ) / degree; i += 1 )
+        {
+            estimate *= two;
+        }
 
-            sum += sign * ( px / fact );
+        // Estimates fall monotonically until they reach the root
 
-            // Flip sign
+        IntType const order( degree );
+        IntType const lower( degree - 1 );
 
-            sign = -( sign );
+        while( true )
+        {
+            IntType quotient( value );
+
+            for( unsigned i = 1; i < degree && quotient > IntType( 0 ); i += 1 )
+            {
+                quotient /= estimate;
+            }
+
+            IntType const next = ( lower * estimate + quotient ) / order;
+
+            if( !( next < estimate ) )
+            {
+                return estimate;
+            }
+
+            estimate = next;
         }
+    }
 
-        // Ensure sign is positive
+    // IS INTEGER POWER -------------------------------------------------------
 
-        sum.makePositive();
+    /*  Returns true if [value] is [base] to the power [degree]. [base] must
+     *  not exceed the [degree]th root of [value], as [integerRoot] returns,
+     *  so the product never overflows.
+     */
 
-        // Return result
-        
-        return sum;
+    template< class IntType >
+    bool const isIntegerPower( IntType const & value,
+                               IntType const & base,
+                               unsigned const degree )
+    {
+        IntType product( 1 );
+
+        for( unsigned i = 0; i < degree; i += 1 )
+        {
+            product *= base;
+        }
+
+        return product == value;
     }
 
-    // TANGENT ----------------------------------------------------------------
+    // ROOT -------------------------------------------------------------------
+
+    /*  Returns the [degree]th root of [x], setting [exact] when both
+     *  components are perfect powers. Roots of components in lowest terms
+     *  are in lowest terms, so an exact root needs no reduction. Otherwise
+     *  the root is approximated in long double. Negative [x] needs an odd
+     *  [degree].
+     */
 
     template< class Calculator >
-    fract< Calculator > const tan( fract< Calculator > const & x )
+    fract< Calculator > const root( fract< Calculator > const & x,
+                                    unsigned const degree,
+                                    bool & exact )
     {
-        return ( sin( x ) / cos( x ) );
+        typedef typename fract< Calculator >::int_type int_type;
+
+        DEBUG_CODE( assert( degree > 0 ) );
+        DEBUG_CODE( assert( x.isPositive() || ( degree % 2 ) == 1 ) );
+
+        int_type const numer = integerRoot( x.getNumerator(), degree );
+        int_type const denom = integerRoot( x.getDenominator(), degree );
+
+        exact = isIntegerPower( x.getNumerator(), numer, degree ) &&
+                isIntegerPower( x.getDenominator(), denom, degree );
+
+        if( exact )
+        {
+            return fract< Calculator >::fromReduced( numer,
+                                                     denom,
+                                                     x.isPositive() );
+        }
+
+        long double const magnitude =
+            std::pow( std::fabs( x.toLongDouble() ), 1.0l / degree );
+
+        return fract< Calculator >( x.isPositive() ? magnitude
+                                                   : -magnitude );
     }
 
     // POWER ------------------------------------------------------------------
 
+    /*  Raises [x] to an integer power by squaring, so an exponent of n
+     *  takes about 2 log2( n ) multiplications, each cancelling common
+     *  factors across its operands in [Calculator]. A negative exponent
+     *  divides one by the positive power once at the end, which needs [x]
+     *  to be non-zero.
+     */
+
     template< class Calculator >
     fract< Calculator > const pow( fract< Calculator > const & x,
                                    int const exponent )
     {
-        // Check for zero exponent
+        // Take the magnitude in unsigned arithmetic, which also holds that
+        // of the most negative exponent
 
-        if( exponent == 0 )
+        unsigned remaining = ( exponent < 0 ) ? 0u - unsigned( exponent )
+                                              : unsigned( exponent );
+
+        fract< Calculator > result( 1, true );
+        fract< Calculator > square( x );
+
+        while( remaining > 0 )
         {
-            return fract< Calculator >( 1, 1, true ); // x^0 == 1
+            if( remaining & 1 )
+            {
+                result *= square;
+            }
+
+            remaining >>= 1;
+
+            if( remaining > 0 )
+            {
+                square *= square;
+            }
+        }
+
+        if( exponent < 0 )
+        {
+            DEBUG_CODE( assert( !x.isZero() ) );
+
+            return fract< Calculator >( 1, true ) / result;
         }
 
-        fract< Calculator > temp( x );
+        return result;
+    }
+
+    /*  Raises [x] to a rational power p/q as the pth power of its qth
+     *  root, setting [exact] as [root] does. An inexact root is not raised
+     *  further, the whole power being approximated in long double instead,
+     *  so the error of the root is not multiplied by p. The numerator of
+     *  [exponent] must fit an int.
+     */
+
+    template< class Calc1, class Calc2 >
+    fract< Calc1 > const pow( fract< Calc1 > const & x,
+                              fract< Calc2 > const & exponent,
+                              bool & exact )
+    {
+        std::uint64_t const numer = std::uint64_t( exponent.getNumerator() );
+        std::uint64_t const denom =
+            std::uint64_t( exponent.getDenominator() );
+
+        DEBUG_CODE( assert( numer <= std::uint64_t(
+                                std::numeric_limits< int >::max() ) ) );
+        DEBUG_CODE( assert( denom <= std::uint64_t(
+                                std::numeric_limits< unsigned >::max() ) ) );
 
-        // Check sign of exponent
+        fract< Calc1 > const base = root( x, unsigned( denom ), exact );
 
-        if( exponent > 0 )
+        if( !exact )
         {
-            for( int i = 1; i < exponent; i += 1 )
+            long double const magnitude =
+                std::pow( std::fabs( x.toLongDouble() ),
+                          exponent.toLongDouble() );
+
+            bool const negative = x.isNegative() && ( numer % 2 ) == 1;
+
+            return fract< Calc1 >( negative ? -magnitude : magnitude );
+        }
+
+        int const power = int( numer );
+
+        return pow( base, exponent.isPositive() ? power : -power );
+    }
+
+    template< class Calc1, class Calc2 >
+    fract< Calc1 > const pow( fract< Calc1 > const & x,
+                              fract< Calc2 > const & exponent )
+    {
+        bool exact = false;
+
+        return pow( x, exponent, exact );
+    }
+    
+    // LIMIT DENOMINATOR ------------------------------------------------------
+
+    /*  Replaces [numer]/[denom] with the closest fraction whose denominator
+     *  does not exceed [limit], leaving it in lowest terms. Ties go to the
+     *  smaller denominator. The fraction is expanded as a continued
+     *  fraction until the next convergent's denominator would pass
+     *  [limit]; the answer is then either the last convergent or the
+     *  largest semiconvergent within [limit]. Which is closer follows from
+     *  the next partial quotient, needing one overflow-free comparison at
+     *  most, and no intermediate exceeds the inputs.
+     */
+
+    template< class IntType >
+    constexpr void limitDenominator( IntType & numer,
+                                     IntType & denom,
+                                     IntType const & limit )
+    {
+        DEBUG_CODE( assert( denom > 0 && limit > 0 ) );
+
+        if( denom <= limit )
+        {
+            return;
+        }
+
+        // Last two convergents, starting from 1/0 and 0/1
+
+        IntType p0( 0 );
+        IntType q0( 1 );
+        IntType p1( 1 );
+        IntType q1( 0 );
+
+        IntType n( numer );
+        IntType d( denom );
+        IntType quotient( 0 );
+
+        for( ;; )
+        {
+            quotient = n / d;
+
+            if( q1 > 0 && quotient > ( limit - q0 ) / q1 )
             {
-                temp *= temp;
+                break;
             }
+
+            IntType const p2 = p0 + quotient * p1;
+            IntType const q2 = q0 + quotient * q1;
+
+            p0 = p1;
+            q0 = q1;
+            p1 = p2;
+            q1 = q2;
+
+            IntType const remainder = n - quotient * d;
+
+            n = d;
+            d = remainder;
+
+            // Inputs not in lowest terms may still have fitted
+
+            if( d == 0 )
+            {
+                numer = p1;
+                denom = q1;
+                return;
+            }
+        }
+
+        // The semiconvergent is closer when the remaining quotient n/d is
+        // below 2k + q0/q1, with k the largest multiple of q1 that fits
+
+        IntType const k = ( limit - q0 ) / q1;
+        IntType const excess = quotient - k;
+
+        bool semiconvergent = excess < k;
+
+        if( excess == k )
+        {
+            semiconvergent = FractComparator::compareMagnitudes
+            (
+                IntType( n - quotient * d ), d, q0, q1
+            ) < 0;
+        }
+
+        if( semiconvergent )
+        {
+            numer = p0 + k * p1;
+            denom = q0 + k * q1;
         }
         else
         {
-            for( int i = -1; i > exponent; i -= 1 )
-            {
-                temp /= temp;
-            }
+            numer = p1;
+            denom = q1;
         }
+    }
+
+    /*  Returns the closest fraction to [x] with a denominator no greater
+     *  than [maxDenominator], as above.
+     */
+
+    template< class Calculator >
+    fract< Calculator > const limitDenominator
+    (
+        fract< Calculator > const & x,
+        typename fract< Calculator >::int_type const & maxDenominator
+    )
+    {
+        typedef typename fract< Calculator >::int_type int_type;
 
-        return temp;
+        // Only calculators with an invalid state produce a zero denominator
+
+        if( x.getDenominator() == 0 )
+        {
+            return x;
+        }
+
+        int_type numer( x.getNumerator() );
+        int_type denom( x.getDenominator() );
+
+        limitDenominator( numer, denom, maxDenominator );
+
+        if( numer == 0 )
+        {
+            return fract< Calculator >( 0, true );
+        }
+
+        return fract< Calculator >::fromReduced( numer,
+                                                 denom,
+                                                 x.isPositive() );
+    }
+
+    // FRACT CAST -------------------------------------------------------------
+
+    /*  Converts [x] to a fraction of [ToCalc], checking that its components
+     *  fit the target's integer type and storage. Widening always succeeds;
+     *  a value too large for a narrower target throws
+     *  [UnsafeOperationException]. The converting constructors do not
+     *  check.
+     */
+
+    template< class ToCalc, class FromCalc >
+    constexpr fract< ToCalc > const fract_cast( fract< FromCalc > const & x )
+    {
+        typedef typename fract< ToCalc >::int_type int_type;
+        typedef typename fract< ToCalc >::storage_type storage_type;
+
+        if( std::numeric_limits< int_type >::is_bounded &&
+            ( x.getNumerator() > std::numeric_limits< int_type >::max() ||
+              x.getDenominator() > storage_type::maxDenominator() ) )
+        {
+            throw UnsafeOperationException();
+        }
+
+        return fract< ToCalc >::fromReduced( int_type( x.getNumerator() ),
+                                             int_type( x.getDenominator() ),
+                                             x.isPositive() );
     }
     
     // OUTPUT STREAM OPERATOR -------------------------------------------------
@@ -226,6 +697,14 @@ namespace fract
     std::ostream & operator << ( std::ostream & out,
                                  fract< Calculator > const & rhs )
     {
+        // Only calculators with an invalid state produce a zero denominator
+
+        if( rhs.getDenominator() == 0 )
+        {
+            out << "nan";
+            return out;
+        }
+
         if( rhs.isZero() )
         {
             out << "0";
@@ -285,7 +764,15 @@ namespace fract
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // FRACTION CLASS +++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    
+
+    /*  [Calculator] supplies the arithmetic as static [add], [mul], [div],
+     *  [areEqual] and [isGreater] over operands in lowest terms, and returns
+     *  results in lowest terms. Every calculator gives zero on division by
+     *  zero, as multiplying by the reciprocal of zero did. Calculators with
+     *  an invalid state give results they cannot represent a zero
+     *  denominator.
+     */
+
     template< class Calculator >
     class fract
     {
@@ -299,74 +786,134 @@ namespace fract
         typedef typename Calculator::int_type int_type;
         typedef long double float_type;
 
+        typedef typename FractStorageTraits< Calculator >::storage_type
+            storage_type;
+
+        typedef typename storage_type::denominator_type denominator_type;
+
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
         // CONSTRUCTORS -------------------------------------------------------
 
-        fract( void )
-        {
-            this->positive = true;
-            this->numer = 0;
-            this->denom = 1;
-        }
+        /*  All constructors other than the floating-point conversion below
+         *  are constexpr when [int_type] is a literal type, so fractions
+         *  built from integer constants are reduced at compile time.
+         */
 
-        fract( int_type whole, bool positive )
+        constexpr fract( void ):
+        storage( 0, 1, true )
+        {}
+
+        constexpr fract( int_type whole, bool positive ):
+        storage( std::move( whole ), 1, positive )
+        {}
+
+        constexpr fract( int_type numerator,
+                         int_type denominator,
+                         bool positive ):
+        storage( std::move( numerator ), std::move( denominator ), positive )
         {
-            this->positive = positive;
-            this->numer = whole;
-            this->denom = 1;
+            if( this->getDenominator() == 0 )
+            {
+                this->storage.setDenominator( 1 );
+            }
+
+            this->simplify();
         }
 
-        fract( int_type numerator, int_type denominator, bool positive )
+        constexpr fract( int_type whole,
+                         int_type numerator,
+                         int_type denominator,
+                         bool positive ):
+        storage( numerator + ( whole * denominator ), denominator, positive )
         {
-            this->positive = positive;
-            this->numer = numerator;
-            this->denom = denominator;
-
-            if( this->denom == 0 )
+            if( this->getDenominator() == 0 )
             {
-                this->denom = 1;
+                this->storage.setDenominator( 1 );
             }
 
             this->simplify();
         }
+        
+        /*  Stores a value of any builtin integer type as [whole]/1, exactly
+         *  as the constructor from [int_type] and a sign does. Without this
+         *  an integer argument would convert equally well to each of the
+         *  floating-point constructors below.
+         */
 
-        fract( int_type whole,
-               int_type numerator,
-               int_type denominator,
-               bool positive )
+        template
+        <
+            class IntegerType,
+            class = typename std::enable_if
+            <
+                std::is_integral< IntegerType >::value
+            >::type
+        >
+        constexpr fract( IntegerType const whole ):
+        storage( magnitude( whole ), 1, !( whole < 0 ) )
+        {}
+
+        /*  Converts a binary floating-point number exactly, as an odd
+         *  integer times a power of two, when both components fit. This
+         *  takes a handful of integer operations. Numbers that do not fit,
+         *  and infinities and NaNs, fall back to [approximate].
+         *
+         *  Exact means a decimal such as 0.1 becomes the dyadic fraction
+         *  nearest it rather than 1/10; use [approximate] for the simplest
+         *  nearby fraction.
+         */
+
+        fract( float const number ):
+        storage( 0, 1, true )
         {
-            this->positive = positive;
-            this->numer = numerator + ( whole * denominator );
-            this->denom = denominator;
+            if( !( this->assignExact( number ) ) )
+            {
+                *this = approximate( number );
+            }
+        }
 
-            if( this->denom == 0 )
+        fract( double const number ):
+        storage( 0, 1, true )
+        {
+            if( !( this->assignExact( number ) ) )
             {
-                this->denom = 1;
+                *this = approximate( number );
             }
+        }
 
-            this->simplify();
+        fract( float_type const number ):
+        storage( 0, 1, true )
+        {
+            if( !( this->assignExact( number ) ) )
+            {
+                *this = approximate( number );
+            }
         }
-        
-        /*  fract( float_type const number );
-         * 
-         *  Calculates the approximate fractional representation of a floating-
-         *  point number using continued fractions. The code for this method
-         *  is adapted from David Eppstein's program [frap.c] available at:
+
+        // APPROXIMATE --------------------------------------------------------
+
+        /*  Calculates the approximate fractional representation of a floating-
+         *  point number using continued fractions, stopping at the last
+         *  convergent whose components fit. The code for this method is
+         *  adapted from David Eppstein's program [frap.c] available at:
          *  http://www.ics.uci.edu/~eppstein/numth/frap.c
          */
-        
-        fract( float_type const number )
+
+        static fract const approximate( float_type const number )
         {
-            // Calculate constants.
-            
-            static unsigned intBits =
-                std::numeric_limits< int_type >::digits;
-            
-            static float_type maxInt =
+            // Calculate constants
+
+            unsigned const intBits = std::numeric_limits< int_type >::digits;
+
+            float_type const maxInt =
                 ( float_type )std::numeric_limits< int_type >::max();
+
+            float_type const maxDenom =
+                ( float_type )storage_type::maxDenominator();
+
+            fract temp;
             
             // Setup matrices to store fractions
             
@@ -398,7 +945,7 @@ namespace fract
                 
                 // Check for maximum integer value
                 
-                if( m3[ 0 ] > maxInt || m3[ 1 ] > maxInt )
+                if( m3[ 0 ] > maxInt || m3[ 1 ] > maxDenom )
                 {
                     break;
                 }
@@ -416,160 +963,172 @@ namespace fract
                 x = 1 / ( x - std::floor( ai ) );
             }
             
-            // Assign results to class members
+            // Assign results to the fraction
             
-            this->numer = ( int_type )m1[ 0 ];
-            this->denom = ( int_type )m1[ 1 ];
+            temp.storage.setNumerator( ( int_type )m1[ 0 ] );
+            temp.storage.setDenominator( ( int_type )m1[ 1 ] );
             
             // Check for edge cases
 
-            if( this->numer < 1 )
+            if( temp.getNumerator() < 1 )
             {
-                this->denom = 1;
-                this->positive = true;
+                temp.storage.setDenominator( 1 );
             }
             else
             {
-                if( this->denom < 1 )
+                if( temp.getDenominator() < 1 )
                 {
-                    this->denom = 1;
+                    temp.storage.setDenominator( 1 );
                 }
 
                 if( number >= 0 )
                 {
-                    this->positive = true;
+                    temp.storage.setPositive( true );
                 }
                 else
                 {
-                    this->positive = false;
+                    temp.storage.setPositive( false );
                 }
             }
+
+            return temp;
         }
         
-        // COPY CONSTRUCTOR ---------------------------------------------------
-        
-        fract( fract const & other )
-        {
-            this->positive = other.positive;
-            this->numer = other.numer;
-            this->denom = other.denom;
-        }
+        // FROM REDUCED -------------------------------------------------------
 
-        template< class Calc >
-        fract( fract< Calc > const & other )
+        /*  Builds a fraction from components that are already in lowest
+         *  terms, skipping the GCD the constructors would otherwise compute.
+         *  Calculators use this for results that are reduced by
+         *  construction.
+         */
+
+        static constexpr fract const fromReduced( int_type numerator,
+                                                  int_type denominator,
+                                                  bool positive )
         {
-            this->positive = other.isPositive();
-            this->numer = other.getNumerator();
-            this->denom = other.getDenominator();
+            fract temp;
+
+            temp.storage = storage_type( std::move( numerator ),
+                                         std::move( denominator ),
+                                         positive );
+
+            return temp;
         }
 
-        // MOVE CONSTRUCTOR ---------------------------------------------------
+        // COPY CONSTRUCTOR ---------------------------------------------------
+
+        /*  Copies and moves between fractions of the same calculator are
+         *  defaulted, so a fraction is trivially copyable whenever its
+         *  storage is.
+         */
         
-        fract( fract && other )
-        {
-            this->positive = other.positive;
-            this->numer = other.numer;
-            this->denom = other.denom;
-        }
+        fract( fract const & other ) = default;
 
         template< class Calc >
-        fract( fract< Calc > && other )
-        {
-            this->positive = other.isPositive();
-            this->numer = other.getNumerator();
-            this->denom = other.getDenominator();
-        }
+        constexpr fract( fract< Calc > const & other ):
+        storage( other.getNumerator(),
+                 other.getDenominator(),
+                 other.isPositive() )
+        {}
 
-        // DESTRUCTOR ---------------------------------------------------------
+        // MOVE CONSTRUCTOR ---------------------------------------------------
+        
+        fract( fract && other ) = default;
 
-        ~fract( void )
-        {
-            // empty
-        }
+        template< class Calc >
+        constexpr fract( fract< Calc > && other ):
+        storage( other.getNumerator(),
+                 other.getDenominator(),
+                 other.isPositive() )
+        {}
 
         // RECIPROCAL ---------------------------------------------------------
 
-        fract const reciprocal( void ) const
+        constexpr fract const reciprocal( void ) const
         {
-            fract temp;
+            // Zero is its own reciprocal, and so is the invalid 0/0 of
+            // calculators that have one
 
-            temp.positive = this->positive;
-            temp.numer = this->denom;
-            temp.denom = this->numer;
-
-            if( temp.denom < 1 )
+            if( this->isZero() )
             {
-                temp.numer = 0;
-                temp.denom = 1;
+                int_type const denom = ( this->getDenominator() == 0 ) ? 0 : 1;
+
+                return fromReduced( 0, denom, this->isPositive() );
             }
 
-            return temp;
+            return fromReduced( this->getDenominator(),
+                                this->getNumerator(),
+                                this->isPositive() );
         }
 
         // GET NUMERATOR ------------------------------------------------------
 
-        int_type const getNumerator( void ) const
+        constexpr int_type const & getNumerator( void ) const
         {
-            return this->numer;
+            return this->storage.getNumerator();
         }
         
         // SET NUMERATOR ------------------------------------------------------
         
-        void setNumerator( int_type numerator )
+        constexpr void setNumerator( int_type numerator )
         {
-            this->numer = numerator;
+            this->storage.setNumerator( std::move( numerator ) );
         }
         
         // GET DENOMINATOR ----------------------------------------------------
 
-        int_type const getDenominator( void ) const
+        /*  Returns a reference to the denominator, or a copy for storage
+         *  layouts that do not hold it as a separate integer.
+         */
+
+        constexpr denominator_type getDenominator( void ) const
         {
-            return this->denom;
+            return this->storage.getDenominator();
         }
         
         // SET DENOMINATOR ----------------------------------------------------
         
-        void setDenominator( int_type denominator )
+        constexpr void setDenominator( int_type denominator )
         {
-            this->denom = denominator;
-            
-            if( this->denom < 1 )
+            if( denominator < 1 )
             {
-                this->denom = 1;
+                denominator = 1;
             }
+
+            this->storage.setDenominator( std::move( denominator ) );
         }
         
         // IS POSITIVE --------------------------------------------------------
 
-        bool const isPositive( void ) const
+        constexpr bool const isPositive( void ) const
         {
-            return this->positive;
+            return this->storage.isPositive();
         }
 
         // IS NEGATIVE --------------------------------------------------------
 
-        bool const isNegative( void ) const
+        constexpr bool const isNegative( void ) const
         {
-            return !( this->positive );
+            return !( this->storage.isPositive() );
         }
         
         // MAKE POSITIVE ------------------------------------------------------
         
-        void makePositive( void )
+        constexpr void makePositive( void )
         {
-            this->positive = true;
+            this->storage.setPositive( true );
         }
         
         // MAKE NEGATIVE ------------------------------------------------------
         
-        void makeNegative( void )
+        constexpr void makeNegative( void )
         {
-            this->positive = false;
+            this->storage.setPositive( false );
         }
         
         // NEGATION -----------------------------------------------------------
         
-        fract const negation( void ) const
+        constexpr fract const negation( void ) const
         {
             fract temp( *this );
             
@@ -580,29 +1139,29 @@ namespace fract
         
         // NEGATE -------------------------------------------------------------
 
-        void negate( void )
+        constexpr void negate( void )
         {
-            this->positive = !( this->positive );
+            this->storage.setPositive( !( this->storage.isPositive() ) );
         }
         
         // IS ZERO ------------------------------------------------------------
 
-        bool const isZero( void ) const
+        constexpr bool const isZero( void ) const
         {
-            return ( this->numer == 0 );
+            return ( this->getNumerator() == 0 );
         }
         
         // TO SHORT -----------------------------------------------------------
 
         short const toShort( void ) const
         {
-            if( this->positive )
+            if( this->isPositive() )
             {
-                return ( this->numer / this->denom );
+                return ( this->getNumerator() / this->getDenominator() );
             }
             else
             {
-                return -( this->numer / this->denom );
+                return -( this->getNumerator() / this->getDenominator() );
             }
         }
 
@@ -610,13 +1169,13 @@ namespace fract
 
         int const toInt( void ) const
         {
-            if( this->positive )
+            if( this->isPositive() )
             {
-                return ( this->numer / this->denom );
+                return ( this->getNumerator() / this->getDenominator() );
             }
             else
             {
-                return -( this->numer / this->denom );
+                return -( this->getNumerator() / this->getDenominator() );
             }
         }
 
@@ -624,13 +1183,13 @@ namespace fract
 
         long const toLongInt( void ) const
         {
-            if( this->positive )
+            if( this->isPositive() )
             {
-                return ( this->numer / this->denom );
+                return ( this->getNumerator() / this->getDenominator() );
             }
             else
             {
-                return -( this->numer / this->denom );
+                return -( this->getNumerator() / this->getDenominator() );
             }
         }
 
@@ -638,15 +1197,15 @@ namespace fract
 
         float const toFloat( void ) const
         {
-            if( this->positive )
+            if( this->isPositive() )
             {
-                return ( ( ( float )this->numer ) /
-                         ( ( float )this->denom ) );
+                return ( ( ( float )this->getNumerator() ) /
+                         ( ( float )this->getDenominator() ) );
             }
             else
             {
-                return -( ( ( float )this->numer ) /
-                          ( ( float )this->denom ) );
+                return -( ( ( float )this->getNumerator() ) /
+                          ( ( float )this->getDenominator() ) );
             }
         }
 
@@ -654,15 +1213,15 @@ namespace fract
 
         double const toDouble( void ) const
         {
-            if( this->positive )
+            if( this->isPositive() )
             {
-                return ( ( ( double )this->numer ) /
-                         ( ( double )this->denom ) );
+                return ( ( ( double )this->getNumerator() ) /
+                         ( ( double )this->getDenominator() ) );
             }
             else
             {
-                return -( ( ( double )this->numer ) /
-                          ( ( double )this->denom ) );
+                return -( ( ( double )this->getNumerator() ) /
+                          ( ( double )this->getDenominator() ) );
             }
         }
 
@@ -670,37 +1229,48 @@ namespace fract
 
         long double const toLongDouble( void ) const
         {
-            if( this->positive )
+            if( this->isPositive() )
             {
-                return ( ( ( long double )this->numer ) /
-                         ( ( long double ) this->denom ) );
+                return ( ( ( long double )this->getNumerator() ) /
+                         ( ( long double )this->getDenominator() ) );
             }
             else
             {
-                return -( ( ( long double )this->numer ) /
-                          ( ( long double ) this->denom ) );
+                return -( ( ( long double )this->getNumerator() ) /
+                          ( ( long double )this->getDenominator() ) );
             }
         }
 
         // SINE ---------------------------------------------------------------
 
+        /*  The trigonometric members forward to the namespace functions,
+         *  which the members would otherwise hide.
+         */
+
         fract const sin( void ) const
         {
-            return sin( *this );
+            return ::fract::sin( *this );
         }
         
         // COSINE -------------------------------------------------------------
 
         fract const cos( void ) const
         {
-            return cos( *this );
+            return ::fract::cos( *this );
+        }
+
+        // SINE AND COSINE ----------------------------------------------------
+
+        void sincos( fract & sine, fract & cosine ) const
+        {
+            ::fract::sincos( *this, sine, cosine );
         }
 
         // TANGENT ------------------------------------------------------------
 
         fract const tan( void ) const
         {
-            return tan( *this );
+            return ::fract::tan( *this );
         }
 
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -709,46 +1279,28 @@ namespace fract
 
         // COPY ASSIGNMENT ----------------------------------------------------
         
-        fract const & operator = ( fract const & other )
-        {
-            fract temp( other );
-
-            this->positive = temp.positive;
-            this->numer = temp.numer;
-            this->denom = temp.denom;
-
-            return *this;
-        }
+        fract & operator = ( fract const & other ) = default;
         
         template< class Calc >
-        fract const & operator = ( fract< Calc > const & other )
+        constexpr fract const & operator = ( fract< Calc > const & other )
         {
-            fract< Calc > temp( other );
-
-            this->positive = temp.positive;
-            this->numer = temp.numer;
-            this->denom = temp.denom;
+            this->storage = storage_type( other.getNumerator(),
+                                          other.getDenominator(),
+                                          other.isPositive() );
 
             return *this;
         }
 
         // MOVE ASSIGNMENT ----------------------------------------------------
         
-        fract const & operator = ( fract && other )
-        {
-            this->positive = other.positive;
-            this->numer = other.numer;
-            this->denom = other.denom;
-
-            return *this;
-        }
+        fract & operator = ( fract && other ) = default;
         
         template< class Calc >
-        fract const & operator = ( fract< Calc > && other )
+        constexpr fract const & operator = ( fract< Calc > && other )
         {
-            this->positive = other.positive;
-            this->numer = other.numer;
-            this->denom = other.denom;
+            this->storage = storage_type( other.getNumerator(),
+                                          other.getDenominator(),
+                                          other.isPositive() );
 
             return *this;
         }
@@ -756,64 +1308,46 @@ namespace fract
         // ADDITION -----------------------------------------------------------
 
         template< class Calc >
-        fract const operator + ( fract< Calc > const & right ) const
+        constexpr fract const operator + ( fract< Calc > const & right ) const
         {
-            // Add operands
-            
-            fract result = CalcType::add( *this, right );
-            
-            // Simplify and return result
+            // Add operands, the calculator returns a reduced result
 
-            result.simplify();
-
-            return result;
+            return CalcType::add( *this, right );
         }
 
         // SUBTRACTION --------------------------------------------------------
 
         template< class Calc >
-        fract const operator - ( fract< Calc > const & right ) const
+        constexpr fract const operator - ( fract< Calc > const & right ) const
         {
             // Add left to negative of right
-            
-            fract result = CalcType::add( *this, right.negation() );
-            
-            // Simplify and return result
 
-            result.simplify();
-
-            return result;
+            return CalcType::add( *this, right.negation() );
         }
 
         // MULTIPLICATION -----------------------------------------------------
 
         template< class Calc >
-        fract const operator * ( fract< Calc > const & right ) const
+        constexpr fract const operator * ( fract< Calc > const & right ) const
         {
-            // Multiply operands
-            
-            fract result = CalcType::mul( *this, right );
-            
-            // Simplify and return result
+            // Multiply operands, the calculator returns a reduced result
 
-            result.simplify();
-
-            return result;
+            return CalcType::mul( *this, right );
         }
 
         // DIVISION -----------------------------------------------------------
 
         template< class Calc >
-        fract const operator / ( fract< Calc > const & right ) const
+        constexpr fract const operator / ( fract< Calc > const & right ) const
         {
-            // Multiply by reciprocal of RHS and return result
+            // Divide operands, the calculator returns a reduced result
 
-            return ( ( *this ) * ( right.reciprocal() ) );
+            return CalcType::div( *this, right );
         }
 
         // UNARY MINUS --------------------------------------------------------
 
-        fract const operator - ( void ) const
+        constexpr fract const operator - ( void ) const
         {
             return this->negation();
         }
@@ -821,25 +1355,25 @@ namespace fract
         // COMPOUND ASSIGNMENT ------------------------------------------------
 
         template< class Calc >
-        fract const & operator += ( fract< Calc > const & right )
+        constexpr fract const & operator += ( fract< Calc > const & right )
         {
             return ( *this ) = ( *this ) + right;
         }
 
         template< class Calc >
-        fract const & operator -= ( fract< Calc > const & right )
+        constexpr fract const & operator -= ( fract< Calc > const & right )
         {
             return ( *this ) = ( *this ) - right;
         }
 
         template< class Calc >
-        fract const & operator *= ( fract< Calc > const & right )
+        constexpr fract const & operator *= ( fract< Calc > const & right )
         {
             return ( *this ) = ( *this ) * right;
         }
 
         template< class Calc >
-        fract const & operator /= ( fract< Calc > const & right )
+        constexpr fract const & operator /= ( fract< Calc > const & right )
         {
             return ( *this ) = ( *this ) / right;
         }
@@ -847,7 +1381,7 @@ namespace fract
         // EQUALITY -----------------------------------------------------------
 
         template< class Calc >
-        bool const operator == ( fract< Calc > const & right ) const
+        constexpr bool const operator == ( fract< Calc > const & right ) const
         {
             return CalcType::areEqual( *this, right );
         }
@@ -855,7 +1389,7 @@ namespace fract
         // INEQUALITY ---------------------------------------------------------
 
         template< class Calc >
-        bool const operator != ( fract< Calc > const & right ) const
+        constexpr bool const operator != ( fract< Calc > const & right ) const
         {
             return !( CalcType::areEqual( *this, right ) );
         }
@@ -863,7 +1397,7 @@ namespace fract
         // GREATER THAN -------------------------------------------------------
 
         template< class Calc >
-        bool const operator > ( fract< Calc > const & right ) const
+        constexpr bool const operator > ( fract< Calc > const & right ) const
         {
             return CalcType::isGreater( *this, right );
         }
@@ -871,7 +1405,7 @@ namespace fract
         // LESS THAN ----------------------------------------------------------
 
         template< class Calc >
-        bool const operator < ( fract< Calc > const & right ) const
+        constexpr bool const operator < ( fract< Calc > const & right ) const
         {
             return CalcType::isLess( *this, right );
         }
@@ -879,7 +1413,7 @@ namespace fract
         // GREATER THAN OR EQUAL ----------------------------------------------
 
         template< class Calc >
-        bool const operator >= ( fract< Calc > const & right ) const
+        constexpr bool const operator >= ( fract< Calc > const & right ) const
         {
             return CalcType::isGreaterOrEqual( *this, right );
         }
@@ -887,7 +1421,7 @@ namespace fract
         // LESS THAN OR EQUAL -------------------------------------------------
 
         template< class Calc >
-        bool const operator <= ( fract< Calc > const & right ) const
+        constexpr bool const operator <= ( fract< Calc > const & right ) const
         {
             return CalcType::isLessOrEqual( *this, right );
         }
@@ -897,14 +1431,18 @@ namespace fract
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
         // PI -----------------------------------------------------------------
+
+        /*  These refer to the calculator's constants, and can be read in
+         *  constant expressions wherever those are constexpr.
+         */
         
-        static fract const & PI;
-        static fract const & TWO_PI;
-        static fract const & HALF_PI;
+        static constexpr fract const & PI = Calculator::PI;
+        static constexpr fract const & TWO_PI = Calculator::TWO_PI;
+        static constexpr fract const & HALF_PI = Calculator::HALF_PI;
 
         // EULER'S CONSTANT ---------------------------------------------------
         
-        static fract const & E;
+        static constexpr fract const & E = Calculator::E;
 
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -916,37 +1454,120 @@ namespace fract
 
         // SIMPLIFY -----------------------------------------------------------
 
-        void simplify( void )
+        constexpr void simplify( void )
         {
-            DEBUG_CODE( assert( this->denom > 0 ) );
+            DEBUG_CODE( assert( this->getDenominator() > 0 ) );
 
             // Check for zero numerator
 
-            if( this->numer == 0 )
+            if( this->isZero() )
             {
-                this->denom = 1;
-                this->positive = true;
+                this->storage = storage_type( 0, 1, true );
                 return;
             }
 
             // Compute greatest common divisor of numerator and denominator
 
-            int_type const divisor = gcd( this->numer, this->denom );
+            int_type const divisor = gcd( this->getNumerator(),
+                                          this->getDenominator() );
 
             // Divide both components by GCD
 
-            this->numer /= divisor;
-            this->denom /= divisor;
+            this->storage.setNumerator( this->getNumerator() / divisor );
+            this->storage.setDenominator( this->getDenominator() / divisor );
+        }
+
+        // MAGNITUDE ----------------------------------------------------------
+
+        /*  Returns the absolute value of [whole] as an [int_type]. Negative
+         *  values are offset by one before negating, so the most negative
+         *  value of a signed type does not overflow.
+         */
+
+        template< class IntegerType >
+        static constexpr int_type const magnitude( IntegerType const whole )
+        {
+            return ( whole < 0 ) ? int_type( -( whole + 1 ) ) + int_type( 1 )
+                                 : int_type( whole );
+        }
+
+        // ASSIGN EXACT -------------------------------------------------------
+
+        /*  Sets this fraction to [number] and returns true if its odd
+         *  mantissa, shifted by its exponent, fits the components. Leaves
+         *  the fraction unchanged and returns false otherwise.
+         */
+
+        template< class FloatType >
+        bool const assignExact( FloatType const number )
+        {
+            int const mantissaBits = std::numeric_limits< FloatType >::digits;
+            int const intBits = std::numeric_limits< int_type >::digits;
+
+            if( mantissaBits > 64 || !( std::isfinite( number ) ) )
+            {
+                return false;
+            }
+
+            if( number == 0 )
+            {
+                this->storage = storage_type( 0, 1, true );
+                return true;
+            }
+
+            // Split into an integer mantissa and a power of two, then
+            // shift trailing zeros from one to the other
+
+            int exponent = 0;
+
+            FloatType const fraction = std::frexp( std::fabs( number ),
+                                                   &exponent );
+            std::uint64_t mantissa =
+                std::uint64_t( std::ldexp( fraction, mantissaBits ) );
+
+            unsigned const zeros = countTrailingZeros( mantissa );
+            int const length = mantissaBits - int( zeros );
+
+            mantissa >>= zeros;
+            exponent -= length;
+
+            // Check the components fit
+
+            if( exponent >= 0 )
+            {
+                if( length + exponent > std::min( intBits, 64 ) )
+                {
+                    return false;
+                }
+
+                this->storage = storage_type( int_type( mantissa << exponent ),
+                                              1,
+                                              number > 0 );
+                return true;
+            }
+
+            if( length > intBits || -exponent > 63 ||
+                ( std::uint64_t( 1 ) << -exponent ) >
+                std::uint64_t( storage_type::maxDenominator() ) )
+            {
+                return false;
+            }
+
+            this->storage = storage_type
+            (
+                int_type( mantissa ),
+                int_type( std::uint64_t( 1 ) << -exponent ),
+                number > 0
+            );
+
+            return true;
         }
 
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
-        int_type numer;
-        int_type denom;
-
-        bool positive;
+        storage_type storage;
 
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     };
@@ -957,19 +1578,19 @@ namespace fract
     
     // PI ---------------------------------------------------------------------
     
-    template< class Calc > fract< Calc > const &
-    fract< Calc >::PI = Calc::PI;
+    template< class Calc > constexpr fract< Calc > const &
+    fract< Calc >::PI;
     
-    template< class Calc > fract< Calc > const &
-    fract< Calc >::TWO_PI = Calc::TWO_PI;
+    template< class Calc > constexpr fract< Calc > const &
+    fract< Calc >::TWO_PI;
     
-    template< class Calc > fract< Calc > const &
-    fract< Calc >::HALF_PI = Calc::HALF_PI;
+    template< class Calc > constexpr fract< Calc > const &
+    fract< Calc >::HALF_PI;
     
     // EULER'S CONSTANT -------------------------------------------------------
     
-    template< class Calc > fract< Calc > const &
-    fract< Calc >::E = Calc::E;
+    template< class Calc > constexpr fract< Calc > const &
+    fract< Calc >::E;
     
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 }
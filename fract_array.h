@@ -0,0 +1,759 @@
+#ifndef FRACT_ARRAY_H
+#define FRACT_ARRAY_H
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <type_traits>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "WideIntegerTraits.h"
+#include "FractComparator.h"
+#include "BatchGcd.h"
+#include "debug.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAMESPACE ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace fract
+{
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FRACT ARRAY CLASS ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /*  A fixed-length sequence of [fract< Calculator >] held as a structure
+     *  of arrays: numerators, denominators and signs each live in their own
+     *  contiguous array. Elements are read and written as fractions by
+     *  [get] and [set], and whole columns are combined by the bulk kernels
+     *  [add], [sub], [mul], [div] and [compare].
+     *
+     *  For builtin components with a wide type the kernels run in passes:
+     *  a [BatchGcd] pass into scratch arrays, then passes with no calls in
+     *  the loop bodies. Products are formed in the wide type, which is a
+     *  single widening multiply, but every division is on [int_type];
+     *  those divisions keep the passes scalar. The scratch arrays belong
+     *  to the result and are reused by later operations into it.
+     *
+     *  Each result that fits is the exact reduced value. The few that
+     *  overflow, including sums too wide for [int_type] before reduction,
+     *  are recomputed by [Calculator] itself, so every element equals what
+     *  the scalar operator gives whenever [Calculator] is exact for
+     *  results in range. The unchecked calculators can wrap in an
+     *  intermediate where the kernels give the exact result. Elements with
+     *  a zero denominator, the invalid state of some calculators, are also
+     *  left to [Calculator]. Other component types are combined element by
+     *  element through [Calculator].
+     */
+
+    template< class Calculator >
+    class fract_array
+    {
+        public:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC TYPES +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef Calculator CalcType;
+        typedef fract< Calculator > value_type;
+        typedef typename value_type::int_type int_type;
+        typedef std::size_t size_type;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // CONSTRUCTORS -------------------------------------------------------
+
+        fract_array( void ) {}
+
+        /*  Creates [count] elements, each zero.
+         */
+
+        explicit fract_array( size_type const count ):
+        numers( count, int_type( 0 ) ),
+        denoms( count, int_type( 1 ) ),
+        positives( count, 1 )
+        {}
+
+        // SIZE ---------------------------------------------------------------
+
+        size_type const size( void ) const
+        {
+            return this->numers.size();
+        }
+
+        // RESIZE -------------------------------------------------------------
+
+        /*  Elements added at the end are zero.
+         */
+
+        void resize( size_type const count )
+        {
+            this->numers.resize( count, int_type( 0 ) );
+            this->denoms.resize( count, int_type( 1 ) );
+            this->positives.resize( count, 1 );
+        }
+
+        // GET ----------------------------------------------------------------
+
+        value_type const get( size_type const index ) const
+        {
+            DEBUG_CODE( assert( index < this->size() ) );
+
+            return value_type::fromReduced( this->numers[ index ],
+                                            this->denoms[ index ],
+                                            this->positives[ index ] != 0 );
+        }
+
+        // SET ----------------------------------------------------------------
+
+        void set( size_type const index, value_type const & value )
+        {
+            DEBUG_CODE( assert( index < this->size() ) );
+
+            this->numers[ index ] = value.getNumerator();
+            this->denoms[ index ] = value.getDenominator();
+            this->positives[ index ] = value.isPositive() ? 1 : 0;
+        }
+
+        // COMPONENT ARRAYS ---------------------------------------------------
+
+        /*  Direct access to the component columns. A sign is 1 for positive
+         *  and 0 for negative. Elements written through these must have a
+         *  non-zero denominator; call [simplify] afterwards unless they are
+         *  already in lowest terms with zero stored as positive 0/1.
+         */
+
+        int_type * getNumerators( void )
+        {
+            return this->numers.data();
+        }
+
+        int_type const * getNumerators( void ) const
+        {
+            return this->numers.data();
+        }
+
+        int_type * getDenominators( void )
+        {
+            return this->denoms.data();
+        }
+
+        int_type const * getDenominators( void ) const
+        {
+            return this->denoms.data();
+        }
+
+        unsigned char * getSigns( void )
+        {
+            return this->positives.data();
+        }
+
+        unsigned char const * getSigns( void ) const
+        {
+            return this->positives.data();
+        }
+
+        // SIMPLIFY -----------------------------------------------------------
+
+        /*  Reduces every element to lowest terms.
+         */
+
+        void simplify( void )
+        {
+            size_type const count = this->size();
+
+            int_type * const numer = this->numers.data();
+            int_type * const denom = this->denoms.data();
+            unsigned char * const sign = this->positives.data();
+
+            int_type * const divisors = this->reserveScratch( count );
+
+            gcdKernel( numer, denom, divisors, count );
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                DEBUG_CODE( assert( denom[ i ] != 0 ) );
+
+                bool const zero = numer[ i ] == 0;
+
+                numer[ i ] = numer[ i ] / divisors[ i ];
+                denom[ i ] = zero ? int_type( 1 ) : denom[ i ] / divisors[ i ];
+                sign[ i ] = zero ? 1 : sign[ i ];
+            }
+        }
+
+        // NEGATE -------------------------------------------------------------
+
+        /*  Negates every element. Zero stays positive.
+         */
+
+        void negate( void )
+        {
+            size_type const count = this->size();
+
+            int_type const * const numer = this->numers.data();
+            unsigned char * const sign = this->positives.data();
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                sign[ i ] = ( numer[ i ] == 0 ) ? 1 : ( sign[ i ] ^ 1 );
+            }
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC STATIC METHODS ++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        /*  The kernels combine elements at equal indices of [lhs] and [rhs],
+         *  which must be the same size. [result] is resized to match and
+         *  may be either operand.
+         */
+
+        // ADD ----------------------------------------------------------------
+
+        static void add( fract_array const & lhs,
+                         fract_array const & rhs,
+                         fract_array & result )
+        {
+            sum( lhs, rhs, result, false, hasWideType() );
+        }
+
+        // SUBTRACT -----------------------------------------------------------
+
+        static void sub( fract_array const & lhs,
+                         fract_array const & rhs,
+                         fract_array & result )
+        {
+            sum( lhs, rhs, result, true, hasWideType() );
+        }
+
+        // MULTIPLY -----------------------------------------------------------
+
+        static void mul( fract_array const & lhs,
+                         fract_array const & rhs,
+                         fract_array & result )
+        {
+            product( lhs, rhs, result, false, hasWideType() );
+        }
+
+        // DIVIDE -------------------------------------------------------------
+
+        /*  Elements divided by zero are zero, as with the calculators.
+         */
+
+        static void div( fract_array const & lhs,
+                         fract_array const & rhs,
+                         fract_array & result )
+        {
+            product( lhs, rhs, result, true, hasWideType() );
+        }
+
+        // COMPARE ------------------------------------------------------------
+
+        /*  Sets each element of [result] to -1, 0 or 1 as the element of
+         *  [lhs] is less than, equal to or greater than that of [rhs], or
+         *  to [unordered] when either has a zero denominator.
+         */
+
+        static void compare( fract_array const & lhs,
+                             fract_array const & rhs,
+                             std::vector< int > & result )
+        {
+            DEBUG_CODE( assert( lhs.size() == rhs.size() ) );
+
+            result.resize( lhs.size() );
+
+            compare( lhs, rhs, result.data(), hasWideType() );
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // UNORDERED ----------------------------------------------------------
+
+        static int const unordered = 2;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        private:
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE TYPES ++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        typedef WideIntegerTraits< int_type > wide_traits;
+        typedef typename wide_traits::wide_type wide_type;
+
+        typedef std::integral_constant
+        <
+            bool,
+            std::is_integral< int_type >::value && wide_traits::hasWideType
+        >
+        hasWideType;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE STATIC METHODS +++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        // GCD KERNEL ---------------------------------------------------------
+
+        static void gcdKernel( int_type const * lhs,
+                               int_type const * rhs,
+                               int_type * result,
+                               size_type const count )
+        {
+            BatchGcd< int_type >::gcd( lhs, rhs, result, count );
+        }
+
+        // RESERVE SCRATCH ----------------------------------------------------
+
+        /*  Sizes the scratch arrays for [count] elements and returns the
+         *  first. They belong to the array the kernels write, so repeated
+         *  operations into one result allocate only when it grows.
+         */
+
+        int_type * reserveScratch( size_type const count )
+        {
+            this->divisors.resize( count );
+            this->commons.resize( count );
+            this->scales.resize( count );
+            this->sums.resize( count );
+            this->signs.resize( count );
+            this->overflows.resize( count );
+
+            return this->divisors.data();
+        }
+
+        // FITS ---------------------------------------------------------------
+
+        /*  Tests whether wide results can be stored as components of
+         *  [value_type].
+         */
+
+        static bool const fits( wide_type const & numer,
+                                wide_type const & denom )
+        {
+            return ( numer >> std::numeric_limits< int_type >::digits ) == 0 &&
+                   denom <= value_type::storage_type::maxDenominator();
+        }
+
+        // SUM (ELEMENT-WISE) -------------------------------------------------
+
+        static void sum( fract_array const & lhs,
+                         fract_array const & rhs,
+                         fract_array & result,
+                         bool const negate,
+                         std::false_type )
+        {
+            DEBUG_CODE( assert( lhs.size() == rhs.size() ) );
+
+            size_type const count = lhs.size();
+
+            result.resize( count );
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                value_type const rValue = negate ? -rhs.get( i ) : rhs.get( i );
+
+                result.set( i, Calculator::add( lhs.get( i ), rValue ) );
+            }
+        }
+
+        // SUM (WIDE) ---------------------------------------------------------
+
+        /*  Scales both numerators to the least common denominator, as in
+         *  [BasicWideFractCalculator::tryAdd], then cancels the factor the
+         *  sum can share with the denominators' GCD. Sums too wide for
+         *  [int_type] before that cancellation are left to [Calculator],
+         *  so the reduction needs only narrow divisions.
+         */
+
+        static void sum( fract_array const & lhs,
+                         fract_array const & rhs,
+                         fract_array & result,
+                         bool const negate,
+                         std::true_type )
+        {
+            DEBUG_CODE( assert( lhs.size() == rhs.size() ) );
+
+            size_type const count = lhs.size();
+
+            int_type const * const lNumer = lhs.numers.data();
+            int_type const * const lDenom = lhs.denoms.data();
+            unsigned char const * const lSign = lhs.positives.data();
+            int_type const * const rNumer = rhs.numers.data();
+            int_type const * const rDenom = rhs.denoms.data();
+            unsigned char const * const rSign = rhs.positives.data();
+
+            unsigned char const flip = negate ? 1 : 0;
+
+            int_type * const divisors = result.reserveScratch( count );
+            int_type * const commons = result.commons.data();
+            int_type * const scales = result.scales.data();
+            int_type * const sums = result.sums.data();
+            unsigned char * const signs = result.signs.data();
+            unsigned char * const overflows = result.overflows.data();
+
+            // Common factors of the denominators
+
+            gcdKernel( lDenom, rDenom, divisors, count );
+
+            // Signed sums of the scaled numerators, with their remainders
+            // by the denominators' GCD. Two invalid operands give a zero
+            // GCD, which is raised to one so the quotients stay defined
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                int_type const divisor =
+                    divisors[ i ] | int_type( divisors[ i ] == 0 );
+
+                int_type const lScale = rDenom[ i ] / divisor;
+                int_type const rScale = lDenom[ i ] / divisor;
+
+                wide_type const lTerm = wide_type( lNumer[ i ] ) * lScale;
+                wide_type const rTerm = wide_type( rNumer[ i ] ) * rScale;
+
+                unsigned char const rPositive = rSign[ i ] ^ flip;
+                bool const same = lSign[ i ] == rPositive;
+                bool const lLarger = lTerm > rTerm;
+
+                wide_type const total = lTerm + rTerm;
+                wide_type const difference = lLarger ? lTerm - rTerm
+                                                     : rTerm - lTerm;
+
+                wide_type const numer = same ? total : difference;
+                int_type const narrow = int_type( numer );
+
+                bool const invalid = lDenom[ i ] == 0 || rDenom[ i ] == 0;
+                bool const wide = ( numer >> intBits ) != 0 ||
+                                  ( same && total < lTerm );
+
+                divisors[ i ] = divisor;
+                commons[ i ] = ( divisor == 1 ) ? int_type( 0 )
+                                                : narrow % divisor;
+                scales[ i ] = rScale;
+                signs[ i ] = ( same || lLarger ) ? lSign[ i ] : rPositive;
+                sums[ i ] = narrow;
+                overflows[ i ] = ( invalid || wide ) ? 1 : 0;
+            }
+
+            // Factors the sums share with the denominators' GCD
+
+            gcdKernel( commons, divisors, commons, count );
+
+            // Reduce and store, keeping the operands of any element that
+            // overflows so it can be recomputed below
+
+            result.resize( count );
+
+            int_type * const numer = result.numers.data();
+            int_type * const denom = result.denoms.data();
+            unsigned char * const sign = result.positives.data();
+
+            bool overflowed = false;
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                int_type const common = commons[ i ];
+
+                int_type const n = sums[ i ] / common;
+                wide_type const d = wide_type( scales[ i ] ) *
+                                    ( rDenom[ i ] / common );
+
+                bool const zero = n == 0;
+                bool const overflow = overflows[ i ] != 0 ||
+                                      ( !zero && !fits( n, d ) );
+
+                overflows[ i ] = overflow ? 1 : 0;
+                overflowed |= overflow;
+
+                if( !overflow )
+                {
+                    numer[ i ] = n;
+                    denom[ i ] = zero ? int_type( 1 ) : int_type( d );
+                    sign[ i ] = zero ? 1 : signs[ i ];
+                }
+            }
+
+            // Recompute overflowing elements with the calculator
+
+            for( size_type i = 0; overflowed && i < count; i += 1 )
+            {
+                if( overflows[ i ] != 0 )
+                {
+                    value_type const rValue = negate ? -rhs.get( i )
+                                                     : rhs.get( i );
+
+                    result.set( i, Calculator::add( lhs.get( i ), rValue ) );
+                }
+            }
+        }
+
+        // PRODUCT (ELEMENT-WISE) ---------------------------------------------
+
+        static void product( fract_array const & lhs,
+                             fract_array const & rhs,
+                             fract_array & result,
+                             bool const invert,
+                             std::false_type )
+        {
+            DEBUG_CODE( assert( lhs.size() == rhs.size() ) );
+
+            size_type const count = lhs.size();
+
+            result.resize( count );
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                result.set( i, invert
+                    ? Calculator::div( lhs.get( i ), rhs.get( i ) )
+                    : Calculator::mul( lhs.get( i ), rhs.get( i ) ) );
+            }
+        }
+
+        // PRODUCT (WIDE) -----------------------------------------------------
+
+        /*  Cross-cancels before multiplying, so the products are in lowest
+         *  terms. Division reads the components of [rhs] the other way
+         *  round.
+         */
+
+        static void product( fract_array const & lhs,
+                             fract_array const & rhs,
+                             fract_array & result,
+                             bool const invert,
+                             std::true_type )
+        {
+            DEBUG_CODE( assert( lhs.size() == rhs.size() ) );
+
+            size_type const count = lhs.size();
+
+            int_type const * const lNumer = lhs.numers.data();
+            int_type const * const lDenom = lhs.denoms.data();
+            unsigned char const * const lSign = lhs.positives.data();
+            int_type const * const rNumer = invert ? rhs.denoms.data()
+                                                   : rhs.numers.data();
+            int_type const * const rDenom = invert ? rhs.numers.data()
+                                                   : rhs.denoms.data();
+            unsigned char const * const rSign = rhs.positives.data();
+            int_type const * const lValid = lhs.denoms.data();
+            int_type const * const rValid = rhs.denoms.data();
+
+            int_type * const lCommons = result.reserveScratch( count );
+            int_type * const rCommons = result.commons.data();
+            unsigned char * const overflows = result.overflows.data();
+
+            // Common factors across the operands. A zero divisor or an
+            // invalid operand can give a zero GCD, which is raised to one so
+            // the quotients below stay defined
+
+            gcdKernel( lNumer, rDenom, lCommons, count );
+            gcdKernel( rNumer, lDenom, rCommons, count );
+
+            // Multiply and store, keeping the operands of any element that
+            // overflows so it can be recomputed below
+
+            result.resize( count );
+
+            int_type * const numer = result.numers.data();
+            int_type * const denom = result.denoms.data();
+            unsigned char * const sign = result.positives.data();
+
+            bool overflowed = false;
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                int_type const lCommon =
+                    lCommons[ i ] | int_type( lCommons[ i ] == 0 );
+                int_type const rCommon =
+                    rCommons[ i ] | int_type( rCommons[ i ] == 0 );
+
+                wide_type const n = wide_type( lNumer[ i ] / lCommon ) *
+                                    ( rNumer[ i ] / rCommon );
+                wide_type const d = wide_type( lDenom[ i ] / rCommon ) *
+                                    ( rDenom[ i ] / lCommon );
+
+                bool const zero = n == 0 || d == 0;
+                bool const invalid = lValid[ i ] == 0 || rValid[ i ] == 0;
+                bool const overflow = invalid || ( !zero && !fits( n, d ) );
+
+                overflows[ i ] = overflow ? 1 : 0;
+                overflowed |= overflow;
+
+                if( !overflow )
+                {
+                    numer[ i ] = zero ? int_type( 0 ) : int_type( n );
+                    denom[ i ] = zero ? int_type( 1 ) : int_type( d );
+                    sign[ i ] = zero ? 1 : ( lSign[ i ] == rSign[ i ] );
+                }
+            }
+
+            // Recompute overflowing elements with the calculator
+
+            for( size_type i = 0; overflowed && i < count; i += 1 )
+            {
+                if( overflows[ i ] != 0 )
+                {
+                    result.set( i, invert
+                        ? Calculator::div( lhs.get( i ), rhs.get( i ) )
+                        : Calculator::mul( lhs.get( i ), rhs.get( i ) ) );
+                }
+            }
+        }
+
+        // COMPARE (ELEMENT-WISE) ---------------------------------------------
+
+        static void compare( fract_array const & lhs,
+                             fract_array const & rhs,
+                             int * result,
+                             std::false_type )
+        {
+            size_type const count = lhs.size();
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                int const order = FractComparator::compare( lhs.get( i ),
+                                                            rhs.get( i ) );
+                bool const invalid =
+                    lhs.getDenominators()[ i ] == 0 ||
+                    rhs.getDenominators()[ i ] == 0;
+
+                result[ i ] = invalid ? unordered
+                                      : ( order > 0 ) - ( order < 0 );
+            }
+        }
+
+        // COMPARE (WIDE) -----------------------------------------------------
+
+        /*  Compares signs, then cross products, as [FractComparator] does
+         *  but without its early exits.
+         */
+
+        static void compare( fract_array const & lhs,
+                             fract_array const & rhs,
+                             int * result,
+                             std::true_type )
+        {
+            size_type const count = lhs.size();
+
+            int_type const * const lNumer = lhs.numers.data();
+            int_type const * const lDenom = lhs.denoms.data();
+            unsigned char const * const lSign = lhs.positives.data();
+            int_type const * const rNumer = rhs.numers.data();
+            int_type const * const rDenom = rhs.denoms.data();
+            unsigned char const * const rSign = rhs.positives.data();
+
+            for( size_type i = 0; i < count; i += 1 )
+            {
+                int const lSigned = ( lNumer[ i ] == 0 ) ? 0
+                                  : ( lSign[ i ] != 0 ? 1 : -1 );
+                int const rSigned = ( rNumer[ i ] == 0 ) ? 0
+                                  : ( rSign[ i ] != 0 ? 1 : -1 );
+
+                wide_type const lCross = wide_type( lNumer[ i ] ) * rDenom[ i ];
+                wide_type const rCross = wide_type( rNumer[ i ] ) * lDenom[ i ];
+
+                int const magnitude = ( lCross > rCross ) - ( lCross < rCross );
+                bool const invalid = lDenom[ i ] == 0 || rDenom[ i ] == 0;
+
+                int const order = ( lSigned != rSigned )
+                    ? ( ( lSigned < rSigned ) ? -1 : 1 )
+                    : lSigned * magnitude;
+
+                result[ i ] = invalid ? unordered : order;
+            }
+        }
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // PRIVATE DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+        std::vector< int_type > numers;
+        std::vector< int_type > denoms;
+        std::vector< unsigned char > positives;
+
+        // SCRATCH ------------------------------------------------------------
+
+        std::vector< int_type > divisors;
+        std::vector< int_type > commons;
+        std::vector< int_type > scales;
+        std::vector< int_type > sums;
+        std::vector< unsigned char > signs;
+        std::vector< unsigned char > overflows;
+
+        // INTEGER BITS -------------------------------------------------------
+
+        static constexpr unsigned const intBits =
+            std::numeric_limits< int_type >::digits;
+
+        // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    };
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // PUBLIC STATIC DATA +++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // UNORDERED --------------------------------------------------------------
+
+    template< class Calculator >
+    int const fract_array< Calculator >::unordered;
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // FUNCTIONS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // SIMPLIFY ---------------------------------------------------------------
+
+    /*  Reduces every fraction in [first, last) to lowest terms with one
+     *  [BatchGcd] pass, for arrays whose components were written through
+     *  [setNumerator] and [setDenominator].
+     */
+
+    template< class Calc >
+    void simplify( fract< Calc > * first, fract< Calc > * last )
+    {
+        typedef typename fract< Calc >::int_type int_type;
+
+        std::size_t const count = std::size_t( last - first );
+
+        std::vector< int_type > numers( count );
+        std::vector< int_type > denoms( count );
+        std::vector< int_type > divisors( count );
+
+        for( std::size_t i = 0; i < count; i += 1 )
+        {
+            numers[ i ] = first[ i ].getNumerator();
+            denoms[ i ] = first[ i ].getDenominator();
+        }
+
+        BatchGcd< int_type >::gcd( numers.data(), denoms.data(),
+                                   divisors.data(), count );
+
+        for( std::size_t i = 0; i < count; i += 1 )
+        {
+            bool const zero = numers[ i ] == 0;
+
+            first[ i ] = fract< Calc >::fromReduced
+            (
+                numers[ i ] / divisors[ i ],
+                zero ? int_type( 1 ) : int_type( denoms[ i ] / divisors[ i ] ),
+                zero || first[ i ].isPositive()
+            );
+        }
+    }
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#endif // FRACT_ARRAY_H
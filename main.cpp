@@ -2,6 +2,7 @@
 // INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+#include <algorithm>
 #include <iostream>
 #include <cstdint>
 #include <iomanip>
@@ -11,8 +12,17 @@
 #include <ctime>
 
 #include "CheckedSafeFractCalculator.h"
+#include "SaturatingFractCalculator.h"
+#include "PromotingFractCalculator.h"
+#include "BoundedFractCalculator.h"
+#include "Int128FractCalculator.h"
 #include "UnsafeFractCalculator.h"
+#include "PackedFractCalculator.h"
+#include "WideFractCalculator.h"
+#include "BigFractCalculator.h"
 #include "SafeFractCalculator.h"
+#include "NanFractCalculator.h"
+#include "fract_array.h"
 #include "matrix.h"
 #include "sfract.h"
 #include "fract.h"
@@ -306,10 +316,19 @@ bool const runSineTests( int_type divisionCount, int_type loopCount )
     typedef fract::fract< fract::UnsafeFractCalculator > unsafe_fract;
     typedef fract::fract< fract::SafeFractCalculator > safe_fract;
     typedef fract::fract< fract::CheckedSafeFractCalculator > checked_fract;
+    typedef fract::fract
+    <
+        fract::BasicCheckedSafeFractCalculator< fract::DivisionOverflowCheck >
+    >
+    division_checked_fract;
+    typedef fract::fract< fract::BigFractCalculator > big_fract;
+    typedef fract::fract< fract::PromotingFractCalculator > promoting_fract;
     typedef fract::sfract< checked_fract, std::allocator< char > >
         std_sfract_type;
     typedef fract::sfract< checked_fract >
         pooled_sfract_type;
+    typedef fract::sfract< big_fract >
+        big_sfract_type;
     
     // Check inputs
 
@@ -326,8 +345,12 @@ bool const runSineTests( int_type divisionCount, int_type loopCount )
     safe_fract safeFractSum( 0, true );
     unsafe_fract unsafeFractSum( 0, true );
     checked_fract checkedSafeFractSum( 0, true );
+    division_checked_fract divisionCheckedFractSum( 0, true );
+    big_fract bigFractSum( 0, true );
+    promoting_fract promotingFractSum( 0, true );
     std_sfract_type std_sfractSum( checkedSafeFractSum );
     pooled_sfract_type pooled_sfractSum( checkedSafeFractSum );
+    big_sfract_type big_sfractSum( bigFractSum );
 
     float_type floatSum = 0.0l;
     float_type runTime = 0.0l;
@@ -367,13 +390,27 @@ bool const runSineTests( int_type divisionCount, int_type loopCount )
     }
     
     // Safe fract Test
+
+    typedef fract::SafeFractCalculator safe_calculator;
+
+    safe_calculator::resetFallbackCounts();
     
     if( sineTest( divisionCount, loopCount, runTime, safeFractSum ) )
     {
         std::cout << "sine test using fract:\n";
         std::cout << "    - SafeFractCalculator\n";
         std::cout << "sum      = " << safeFractSum.toLongDouble() << "\n";
-        std::cout << "run time = " << runTime << " seconds\n\n\n";
+        std::cout << "run time = " << runTime << " seconds\n";
+        std::cout << "fallbacks: add = "
+                  << safe_calculator::fallbackCount
+                     ( safe_calculator::ADDITION )
+                  << ", mul = "
+                  << safe_calculator::fallbackCount
+                     ( safe_calculator::MULTIPLICATION )
+                  << ", div = "
+                  << safe_calculator::fallbackCount
+                     ( safe_calculator::DIVISION )
+                  << "\n\n\n";
     }
     else
     {
@@ -401,6 +438,59 @@ bool const runSineTests( int_type divisionCount, int_type loopCount )
         return false;
     }
 
+    // Checked safe fract test, dividing to check overflow
+
+    if( sineTest( divisionCount, loopCount, runTime, divisionCheckedFractSum ) )
+    {
+        std::cout << "sine test using fract:\n";
+        std::cout << "    - CheckedSafeFractCalculator ( division checks )\n";
+        std::cout << "sum      = " << divisionCheckedFractSum.toLongDouble();
+        std::cout << "\n";
+        std::cout << "run time = " << runTime << " seconds\n\n\n";
+    }
+    else
+    {
+        std::cout << "sine test using fract:\n";
+        std::cout << "    - CheckedSafeFractCalculator ( division checks )\n";
+        std::cout << "FAILED\n\n\n";
+        return false;
+    }
+
+    // Big fract test
+
+    if( sineTest( divisionCount, loopCount, runTime, bigFractSum ) )
+    {
+        std::cout << "sine test using fract:\n";
+        std::cout << "    - BigFractCalculator\n";
+        std::cout << "sum      = " << bigFractSum.toLongDouble() << "\n";
+        std::cout << "run time = " << runTime << " seconds\n\n\n";
+    }
+    else
+    {
+        std::cout << "sine test using fract:\n";
+        std::cout << "    - BigFractCalculator\n";
+        std::cout << "FAILED\n\n\n";
+        return false;
+    }
+
+    // Promoting fract test
+
+    if( sineTest( divisionCount, loopCount, runTime, promotingFractSum ) )
+    {
+        std::cout << "sine test using fract:\n";
+        std::cout << "    - PromotingFractCalculator\n";
+        std::cout << "sum      = " << promotingFractSum.toLongDouble();
+        std::cout << "\n";
+        std::cout << "run time = " << runTime << " seconds\n\n\n";
+    }
+    else
+    {
+        std::cout << "sine test using fract:\n";
+        std::cout << "    - PromotingFractCalculator\n";
+        std::cout << "FAILED\n\n\n";
+        return false;
+    }
+
     // Standard allocating symbolic fract test
 
     if( sineTest( divisionCount, loopCount, runTime, std_sfractSum ) )
@@ -447,9 +537,1771 @@ bool const runSineTests( int_type divisionCount, int_type loopCount )
         return false;
     }
     
+    // Big symbolic fract test
+
+    if( sineTest( divisionCount, loopCount, runTime, big_sfractSum ) )
+    {
+        std::cout << "sine test using sfract\n";
+        std::cout << "    - fract\n";
+        std::cout << "        - BigFractCalculator\n";
+        std::cout << "    - PooledAllocator\n";
+        std::cout << "sum      = ";
+        std::cout << ( big_sfractSum.evaluate() ).toLongDouble();
+        std::cout << "\n";
+        std::cout << "run time = " << runTime << " seconds\n\n\n";
+    }
+    else
+    {
+        std::cout << "sine test using sfract\n";
+        std::cout << "    - fract\n";
+        std::cout << "        - BigFractCalculator\n";
+        std::cout << "    - PooledAllocator\n";
+        std::cout << "FAILED\n\n\n";
+        return false;
+    }
+
+    return true;
+}
+
+// TOLERANCE TEST -------------------------------------------------------------
+
+template< class Calc >
+bool const toleranceTest( int_type const divisionCount,
+                          int_type const loopCount,
+                          fract::fract< Calc > const & tolerance,
+                          float_type & runTime,
+                          fract::fract< Calc > & sum,
+                          int_type & terms )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( divisionCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    sum = fract_type( 0, true );
+    terms = 0;
+
+    // Construct input table
+
+    fract_type * table = new fract_type[ ( unsigned int )divisionCount ];
+    fract_type const delta = fract_type::HALF_PI /
+                             fract_type( divisionCount, true );
+
+    for( int_type i = 0; i < divisionCount; i += 1 )
+    {
+        table[ i ] = delta * fract_type( i + 1, true );
+    }
+
+    // Perform test
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        for( int_type j = 0; j < divisionCount; j += 1 )
+        {
+            unsigned used = 0;
+
+            sum += fract::sin( table[ j ], tolerance, used );
+            terms += used;
+        }
+    }
+
+    float_type endTime = seconds();
+
+    // Output timing
+
+    runTime = endTime - startTime;
+
+    // Clean up table
+
+    delete[] table;
+
+    return true;
+}
+
+// RUN TOLERANCE TESTS --------------------------------------------------------
+
+template< class Calc >
+bool const runToleranceTest( std::string const & name,
+                             int_type const divisionCount,
+                             int_type const loopCount )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    int_type const denominators[ 3 ] = { 1000u, 1000000u, 1000000000000u };
+
+    bool passed = true;
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    for( unsigned i = 0; i < 3; i += 1 )
+    {
+        fract_type const tolerance( 1, denominators[ i ], true );
+        fract_type sum;
+        float_type runTime = 0.0l;
+        int_type terms = 0;
+
+        std::cout << "sine test with tolerance 1/" << denominators[ i ];
+        std::cout << " using fract:\n";
+        std::cout << "    - " << name << "\n";
+
+        if( toleranceTest< Calc >( divisionCount, loopCount, tolerance,
+                                   runTime, sum, terms ) )
+        {
+            std::cout << "sum      = " << sum.toLongDouble() << "\n";
+            std::cout << "terms    = " << terms << "\n";
+            std::cout << "run time = " << runTime << " seconds\n\n\n";
+        }
+        else
+        {
+            std::cout << "FAILED\n\n\n";
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+bool const runToleranceTests( int_type divisionCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( divisionCount < 1 )
+    {
+        divisionCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    bool passed = true;
+
+    passed &= runToleranceTest< fract::CheckedSafeFractCalculator >
+        ( "CheckedSafeFractCalculator", divisionCount, loopCount );
+
+    passed &= runToleranceTest< fract::BigFractCalculator >
+        ( "BigFractCalculator", divisionCount, loopCount );
+
+    return passed;
+}
+
+// BACKEND TEST ---------------------------------------------------------------
+
+template< class Calc, class Backend >
+bool const backendTest( int_type const divisionCount,
+                        int_type const loopCount,
+                        float_type & runTime,
+                        fract::fract< Calc > & sum,
+                        float_type & maxError )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( divisionCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    sum = fract_type( 0, true );
+    maxError = 0.0l;
+
+    // Construct input table
+
+    fract_type * table = new fract_type[ ( unsigned int )divisionCount ];
+    fract_type const delta = fract_type::HALF_PI /
+                             fract_type( divisionCount, true );
+
+    for( int_type i = 0; i < divisionCount; i += 1 )
+    {
+        table[ i ] = delta * fract_type( i + 1, true );
+    }
+
+    // Perform test
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        for( int_type j = 0; j < divisionCount; j += 1 )
+        {
+            sum += Backend::sin( table[ j ] );
+        }
+    }
+
+    float_type endTime = seconds();
+
+    // Output timing
+
+    runTime = endTime - startTime;
+
+    // Find largest error against floating-point sine
+
+    for( int_type j = 0; j < divisionCount; j += 1 )
+    {
+        float_type const error =
+            std::fabs( Backend::sin( table[ j ] ).toLongDouble() -
+                       std::sin( table[ j ].toLongDouble() ) );
+
+        maxError = std::max( maxError, error );
+    }
+
+    // Clean up table
+
+    delete[] table;
+
     return true;
 }
 
+// RUN BACKEND TESTS ----------------------------------------------------------
+
+template< class Calc, class Backend >
+bool const runBackendTest( std::string const & name,
+                           std::string const & backend,
+                           int_type const divisionCount,
+                           int_type const loopCount )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    fract_type sum;
+    float_type runTime = 0.0l;
+    float_type maxError = 0.0l;
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+    std::cout << "sine test with " << backend << " backend using fract:\n";
+    std::cout << "    - " << name << "\n";
+
+    if( backendTest< Calc, Backend >( divisionCount, loopCount,
+                                      runTime, sum, maxError ) )
+    {
+        std::cout << "sum       = " << sum.toLongDouble() << "\n";
+        std::cout << std::scientific;
+        std::cout << "max error = " << maxError << "\n";
+        std::cout << std::fixed;
+        std::cout << "run time  = " << runTime << " seconds\n\n\n";
+
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+
+    return false;
+}
+
+bool const runBackendTests( int_type divisionCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( divisionCount < 1 )
+    {
+        divisionCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    bool passed = true;
+
+    passed &= runBackendTest
+    <
+        fract::CheckedSafeFractCalculator, fract::TaylorTrig
+    >
+    ( "CheckedSafeFractCalculator", "Taylor", divisionCount, loopCount );
+
+    passed &= runBackendTest
+    <
+        fract::CheckedSafeFractCalculator, fract::MinimaxTrig
+    >
+    ( "CheckedSafeFractCalculator", "minimax", divisionCount, loopCount );
+
+    passed &= runBackendTest
+    <
+        fract::CheckedSafeFractCalculator, fract::CordicTrig
+    >
+    ( "CheckedSafeFractCalculator", "CORDIC", divisionCount, loopCount );
+
+    passed &= runBackendTest< fract::BigFractCalculator, fract::TaylorTrig >
+        ( "BigFractCalculator", "Taylor", divisionCount, loopCount );
+
+    passed &= runBackendTest< fract::BigFractCalculator, fract::MinimaxTrig >
+        ( "BigFractCalculator", "minimax", divisionCount, loopCount );
+
+    passed &= runBackendTest< fract::BigFractCalculator, fract::CordicTrig >
+        ( "BigFractCalculator", "CORDIC", divisionCount, loopCount );
+
+    return passed;
+}
+
+// ROTATION TEST --------------------------------------------------------------
+
+template< class Calc >
+bool const rotationTest( int_type const divisionCount,
+                         int_type const loopCount,
+                         bool const fused,
+                         float_type & runTime,
+                         fract::fract< Calc > & sum )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( divisionCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    sum = fract_type( 0, true );
+
+    // Construct input table
+
+    fract_type * table = new fract_type[ ( unsigned int )divisionCount ];
+    fract_type const delta = fract_type::HALF_PI /
+                             fract_type( divisionCount, true );
+
+    for( int_type i = 0; i < divisionCount; i += 1 )
+    {
+        table[ i ] = delta * fract_type( i + 1, true );
+    }
+
+    // Perform test, building the four rotation entries for each angle
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        for( int_type j = 0; j < divisionCount; j += 1 )
+        {
+            fract_type entries[ 4 ];
+
+            if( fused )
+            {
+                fract_type sine, cosine;
+
+                fract::sincos( table[ j ], sine, cosine );
+
+                entries[ 0 ] = cosine;
+                entries[ 1 ] = -sine;
+                entries[ 2 ] = sine;
+                entries[ 3 ] = cosine;
+            }
+            else
+            {
+                entries[ 0 ] = table[ j ].cos();
+                entries[ 1 ] = -table[ j ].sin();
+                entries[ 2 ] = table[ j ].sin();
+                entries[ 3 ] = table[ j ].cos();
+            }
+
+            sum += entries[ 0 ] + entries[ 2 ];
+        }
+    }
+
+    float_type endTime = seconds();
+
+    // Output timing
+
+    runTime = endTime - startTime;
+
+    // Clean up table
+
+    delete[] table;
+
+    return true;
+}
+
+// RUN ROTATION TESTS ---------------------------------------------------------
+
+template< class Calc >
+bool const runRotationTest( std::string const & name,
+                            int_type const divisionCount,
+                            int_type const loopCount )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    char const * const methods[ 2 ] = { "sin and cos", "sincos" };
+
+    bool passed = true;
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    for( unsigned i = 0; i < 2; i += 1 )
+    {
+        fract_type sum;
+        float_type runTime = 0.0l;
+
+        std::cout << "rotation test with " << methods[ i ];
+        std::cout << " using fract:\n";
+        std::cout << "    - " << name << "\n";
+
+        if( rotationTest< Calc >( divisionCount, loopCount, i == 1,
+                                  runTime, sum ) )
+        {
+            std::cout << "sum      = " << sum.toLongDouble() << "\n";
+            std::cout << "run time = " << runTime << " seconds\n\n\n";
+        }
+        else
+        {
+            std::cout << "FAILED\n\n\n";
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+bool const runRotationTests( int_type divisionCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( divisionCount < 1 )
+    {
+        divisionCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    bool passed = true;
+
+    passed &= runRotationTest< fract::CheckedSafeFractCalculator >
+        ( "CheckedSafeFractCalculator", divisionCount, loopCount );
+
+    passed &= runRotationTest< fract::BigFractCalculator >
+        ( "BigFractCalculator", divisionCount, loopCount );
+
+    return passed;
+}
+
+// HARMONIC TEST --------------------------------------------------------------
+
+template< class Calc >
+bool const harmonicTest( int_type const termCount,
+                         int_type const loopCount,
+                         float_type & runTime,
+                         fract::fract< Calc > & sum )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( termCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    sum = fract_type( 0, true );
+
+    // Construct input table of unit fractions
+
+    fract_type * table = new fract_type[ ( unsigned int )termCount ];
+
+    for( int_type i = 0; i < termCount; i += 1 )
+    {
+        table[ i ] = fract_type( 1, i + 1, true );
+    }
+
+    // Perform test
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        for( int_type j = 0; j < termCount; j += 1 )
+        {
+            sum += table[ j ];
+        }
+    }
+
+    float_type endTime = seconds();
+
+    // Output timing
+
+    runTime = endTime - startTime;
+
+    // Clean up table
+
+    delete[] table;
+
+    return true;
+}
+
+// RUN HARMONIC TESTS ---------------------------------------------------------
+
+template< class Calc >
+bool const runHarmonicTest( std::string const & name,
+                            int_type const termCount,
+                            int_type const loopCount )
+{
+    fract::fract< Calc > sum( 0, true );
+    float_type runTime = 0.0l;
+
+    std::cout << "harmonic test using fract:\n";
+    std::cout << "    - " << name << "\n";
+
+    try
+    {
+        if( harmonicTest( termCount, loopCount, runTime, sum ) )
+        {
+            std::cout << "sum      = " << sum << "\n";
+            std::cout << "run time = " << runTime << " seconds\n\n\n";
+            return true;
+        }
+    }
+    catch( fract::UnsafeOperationException const & exception )
+    {
+        std::cout << exception.what() << "\n";
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runHarmonicTests( int_type termCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( termCount < 1 )
+    {
+        termCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    bool passed = true;
+
+    passed &= runHarmonicTest< fract::UnsafeFractCalculator >
+        ( "UnsafeFractCalculator", termCount, loopCount );
+
+    passed &= runHarmonicTest< fract::SafeFractCalculator >
+        ( "SafeFractCalculator", termCount, loopCount );
+
+    passed &= runHarmonicTest< fract::CheckedSafeFractCalculator >
+        ( "CheckedSafeFractCalculator", termCount, loopCount );
+
+    passed &= runHarmonicTest< fract::BigFractCalculator >
+        ( "BigFractCalculator", termCount, loopCount );
+
+    passed &= runHarmonicTest< fract::PromotingFractCalculator >
+        ( "PromotingFractCalculator", termCount, loopCount );
+
+#if defined( __SIZEOF_INT128__ )
+
+    passed &= runHarmonicTest< fract::Int128FractCalculator >
+        ( "Int128FractCalculator", termCount, loopCount );
+
+    passed &= runHarmonicTest< fract::BoundedFractCalculator< 1000000000 > >
+        ( "BoundedFractCalculator< 1000000000 >", termCount, loopCount );
+
+#endif
+
+    return passed;
+}
+
+// POWER TEST -----------------------------------------------------------------
+
+template< class Calc >
+bool const powerTest( int const exponent,
+                      int_type const loopCount,
+                      float_type & runTime,
+                      float_type & productTime,
+                      fract::fract< Calc > & result )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( exponent < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    productTime = 0.0l;
+
+    // Compound growth of one part in a thousand
+
+    fract_type const base( 1001, 1000, true );
+
+    // Perform test by squaring
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        result = fract::pow( base, exponent );
+    }
+
+    float_type endTime = seconds();
+
+    runTime = endTime - startTime;
+
+    // Perform test by repeated multiplication
+
+    fract_type product;
+
+    startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        product = fract_type( 1, true );
+
+        for( int j = 0; j < exponent; j += 1 )
+        {
+            product *= base;
+        }
+    }
+
+    endTime = seconds();
+
+    productTime = endTime - startTime;
+
+    return product == result;
+}
+
+// RUN POWER TESTS ------------------------------------------------------------
+
+template< class Calc >
+bool const runPowerTest( std::string const & name,
+                         int const exponent,
+                         int_type const loopCount )
+{
+    fract::fract< Calc > result;
+    float_type runTime = 0.0l;
+    float_type productTime = 0.0l;
+
+    std::cout << "power test using fract:\n";
+    std::cout << "    - " << name << "\n";
+
+    if( powerTest( exponent, loopCount, runTime, productTime, result ) )
+    {
+        std::cout << "result        = " << result.toLongDouble() << "\n";
+        std::cout << "run time      = " << runTime << " seconds\n";
+        std::cout << "multiply time = " << productTime << " seconds\n\n\n";
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runPowerTests( int exponent, int_type loopCount )
+{
+    // Check inputs
+
+    if( exponent < 1 )
+    {
+        exponent = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    bool passed = true;
+
+    passed &= runPowerTest< fract::BigFractCalculator >
+        ( "BigFractCalculator", exponent, loopCount );
+
+    passed &= runPowerTest< fract::PromotingFractCalculator >
+        ( "PromotingFractCalculator", exponent, loopCount );
+
+    return passed;
+}
+
+// BATCH TEST -----------------------------------------------------------------
+
+template< class Calc >
+bool const batchTest( int_type const elementCount,
+                      int_type const loopCount,
+                      float_type & runTime,
+                      int_type & caught,
+                      float_type & checksum )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( elementCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    caught = 0;
+    checksum = 0.0l;
+
+    // Construct input tables of fractions with 17-bit and 16-bit
+    // components, whose products overflow 32-bit components now and then
+
+    fract_type * lhs = new fract_type[ ( unsigned int )elementCount ];
+    fract_type * rhs = new fract_type[ ( unsigned int )elementCount ];
+    fract_type * results = new fract_type[ ( unsigned int )elementCount ];
+
+    int_type state = 0x9e3779b97f4a7c15u;
+
+    for( int_type i = 0; i < elementCount; i += 1 )
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        lhs[ i ] = fract_type( state & 0x1ffffu,
+                               ( ( state >> 17 ) & 0x1ffffu ) | 1u,
+                               true );
+
+        rhs[ i ] = fract_type( ( state >> 34 ) & 0xffffu,
+                               ( ( state >> 50 ) & 0xffffu ) | 1u,
+                               ( state & 0x100u ) != 0 );
+    }
+
+    // Perform test, standing zero in for each failed product
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        float_type startTime = seconds();
+
+        for( int_type j = 0; j < elementCount; j += 1 )
+        {
+            try
+            {
+                results[ j ] = lhs[ j ] * rhs[ j ];
+            }
+            catch( fract::UnsafeOperationException const & )
+            {
+                results[ j ] = fract_type( 0, true );
+                caught += 1;
+            }
+        }
+
+        float_type endTime = seconds();
+
+        runTime += endTime - startTime;
+    }
+
+    for( int_type i = 0; i < elementCount; i += 1 )
+    {
+        checksum += results[ i ].toLongDouble();
+    }
+
+    // Clean up tables
+
+    delete[] lhs;
+    delete[] rhs;
+    delete[] results;
+
+    return true;
+}
+
+// RUN BATCH TESTS ------------------------------------------------------------
+
+template< class Calc >
+bool const runBatchTest( std::string const & name,
+                         int_type const elementCount,
+                         int_type const loopCount,
+                         int_type & caught,
+                         float_type & checksum )
+{
+    float_type runTime = 0.0l;
+
+    std::cout << "batch test using fract:\n";
+    std::cout << "    - " << name << "\n";
+
+    if( batchTest< Calc >( elementCount,
+                           loopCount,
+                           runTime,
+                           caught,
+                           checksum ) )
+    {
+        std::cout << "checksum = " << checksum << "\n";
+        std::cout << "caught   = " << caught << "\n";
+        std::cout << "run time = " << runTime << " seconds\n";
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runBatchTests( int_type elementCount, int_type loopCount )
+{
+    typedef fract::StickyFlagErrorPolicy sticky_policy;
+
+    // Check inputs
+
+    if( elementCount < 1 )
+    {
+        elementCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    int_type throwingCaught = 0;
+    int_type stickyCaught = 0;
+    float_type throwingChecksum = 0.0l;
+    float_type stickyChecksum = 0.0l;
+
+    // Throwing policy, catching each failure
+
+    if( !runBatchTest< fract::Int64FractCalculator >
+        (
+            "Int64FractCalculator",
+            elementCount,
+            loopCount,
+            throwingCaught,
+            throwingChecksum
+        ) )
+    {
+        return false;
+    }
+
+    std::cout << "\n\n";
+
+    // Sticky flag policy, checking once per batch
+
+    sticky_policy::clear();
+
+    if( !runBatchTest
+        <
+            fract::BasicWideFractCalculator< std::uint32_t, sticky_policy >
+        >
+        (
+            "Int64FractCalculator, StickyFlagErrorPolicy",
+            elementCount,
+            loopCount,
+            stickyCaught,
+            stickyChecksum
+        ) )
+    {
+        return false;
+    }
+
+    bool const failed = sticky_policy::hasFailed();
+
+    std::cout << "flag     = " << ( failed ? "set" : "clear" ) << "\n";
+
+    // Both policies should give the same results, and the flag should be
+    // raised exactly when the throwing policy threw
+
+    if( stickyCaught != 0 ||
+        stickyChecksum != throwingChecksum ||
+        failed != ( throwingCaught != 0 ) )
+    {
+        std::cout << "FAILED\n\n\n";
+        return false;
+    }
+
+    std::cout << "\n\n";
+
+    return true;
+}
+
+// STREAM TEST ----------------------------------------------------------------
+
+template< class Calc >
+void makeStreamTables( int_type const elementCount,
+                       fract::fract< Calc > * lhs,
+                       fract::fract< Calc > * rhs )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Fill tables with fractions with 16-bit components
+
+    int_type state = 0x9e3779b97f4a7c15u;
+
+    for( int_type i = 0; i < elementCount; i += 1 )
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        lhs[ i ] = fract_type( state & 0xffffu,
+                               ( ( state >> 16 ) & 0xffffu ) | 1u,
+                               true );
+
+        rhs[ i ] = fract_type( ( state >> 32 ) & 0xffffu,
+                               ( ( state >> 48 ) & 0xffffu ) | 1u,
+                               ( state & 0x100u ) != 0 );
+    }
+}
+
+bool const streamTest( int_type const elementCount,
+                       int_type const loopCount,
+                       float_type & runTime,
+                       float_type & sum )
+{
+    typedef fract::fract< fract::CheckedSafeFractCalculator > fract_type;
+
+    // Check inputs
+
+    if( elementCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+
+    // Construct input tables from the same fractions as the fract tests
+
+    fract_type * lhsFract = new fract_type[ ( unsigned int )elementCount ];
+    fract_type * rhsFract = new fract_type[ ( unsigned int )elementCount ];
+    float_type * lhs = new float_type[ ( unsigned int )elementCount ];
+    float_type * rhs = new float_type[ ( unsigned int )elementCount ];
+
+    makeStreamTables( elementCount, lhsFract, rhsFract );
+
+    for( int_type i = 0; i < elementCount; i += 1 )
+    {
+        lhs[ i ] = lhsFract[ i ].toLongDouble();
+        rhs[ i ] = rhsFract[ i ].toLongDouble();
+    }
+
+    // Perform test, summing products as a running total
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        sum = 0.0l;
+
+        float_type startTime = seconds();
+
+        for( int_type j = 0; j < elementCount; j += 1 )
+        {
+            sum += lhs[ j ] * rhs[ j ];
+        }
+
+        float_type endTime = seconds();
+
+        runTime += endTime - startTime;
+    }
+
+    // Clean up tables
+
+    delete[] lhsFract;
+    delete[] rhsFract;
+    delete[] lhs;
+    delete[] rhs;
+
+    return true;
+}
+
+template< class Calc >
+bool const streamTest( int_type const elementCount,
+                       int_type const loopCount,
+                       float_type & runTime,
+                       fract::fract< Calc > & sum )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( elementCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+
+    // Construct input tables
+
+    fract_type * lhs = new fract_type[ ( unsigned int )elementCount ];
+    fract_type * rhs = new fract_type[ ( unsigned int )elementCount ];
+
+    makeStreamTables( elementCount, lhs, rhs );
+
+    // Perform test, summing products as a running total
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        sum = fract_type( 0, true );
+
+        float_type startTime = seconds();
+
+        for( int_type j = 0; j < elementCount; j += 1 )
+        {
+            sum += lhs[ j ] * rhs[ j ];
+        }
+
+        float_type endTime = seconds();
+
+        runTime += endTime - startTime;
+    }
+
+    // Clean up tables
+
+    delete[] lhs;
+    delete[] rhs;
+
+    return true;
+}
+
+// RUN STREAM TESTS -----------------------------------------------------------
+
+template< class FractType >
+bool const runStreamTest( std::string const & name,
+                          int_type const elementCount,
+                          int_type const loopCount,
+                          FractType & sum )
+{
+    float_type runTime = 0.0l;
+
+    std::cout << "stream test using " << name << "\n";
+
+    if( streamTest( elementCount, loopCount, runTime, sum ) )
+    {
+        std::cout << "sum      = " << sum << "\n";
+        std::cout << "run time = " << runTime << " seconds\n\n\n";
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runStreamTests( int_type elementCount, int_type loopCount )
+{
+    typedef fract::BasicSaturatingFractCalculator< std::uint32_t >
+        saturating_calculator;
+
+    typedef fract::BasicNanFractCalculator< std::uint32_t > nan_calculator;
+
+    // Check inputs
+
+    if( elementCount < 1 )
+    {
+        elementCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    float_type floatSum = 0.0l;
+    fract::fract< saturating_calculator > saturatingSum;
+    fract::fract< nan_calculator > nanSum;
+
+    bool passed = true;
+
+    passed &= runStreamTest
+        ( "long double:", elementCount, loopCount, floatSum );
+
+    passed &= runStreamTest
+        (
+            "fract:\n    - BasicSaturatingFractCalculator< std::uint32_t >",
+            elementCount,
+            loopCount,
+            saturatingSum
+        );
+
+    passed &= runStreamTest
+        (
+            "fract:\n    - BasicNanFractCalculator< std::uint32_t >",
+            elementCount,
+            loopCount,
+            nanSum
+        );
+
+    // The saturating sum should track the floating-point one, and the
+    // other should either agree exactly or have become invalid
+
+    float_type const error =
+        std::fabs( saturatingSum.toLongDouble() - floatSum );
+
+    if( !( error <= 1e-6l * std::fabs( floatSum ) ) ||
+        !( nan_calculator::isInvalid( nanSum ) ||
+           nanSum == saturatingSum ) )
+    {
+        std::cout << "stream test\nFAILED\n\n\n";
+        return false;
+    }
+
+    return passed;
+}
+
+// SORT TEST ------------------------------------------------------------------
+
+template< class Calc >
+bool const sortTest( int_type const elementCount,
+                     int_type const loopCount,
+                     float_type & runTime )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    // Check inputs
+
+    if( elementCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+
+    // Construct input table of signed fractions with 32-bit components,
+    // using a deterministic xorshift generator so runs are comparable
+
+    fract_type * input = new fract_type[ ( unsigned int )elementCount ];
+    fract_type * table = new fract_type[ ( unsigned int )elementCount ];
+
+    int_type state = 0x9e3779b97f4a7c15u;
+
+    for( int_type i = 0; i < elementCount; i += 1 )
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        input[ i ] = fract_type( state & 0xffffffffu,
+                                 ( state >> 32 ) | 1u,
+                                 ( state & 0x100u ) != 0 );
+    }
+
+    // Perform test
+
+    bool sorted = true;
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        std::copy( input, input + elementCount, table );
+
+        float_type startTime = seconds();
+
+        std::sort( table, table + elementCount );
+
+        float_type endTime = seconds();
+
+        runTime += endTime - startTime;
+
+        // Check ordering
+
+        for( int_type j = 1; j < elementCount; j += 1 )
+        {
+            sorted &= !( table[ j ] < table[ j - 1 ] );
+        }
+    }
+
+    // Clean up tables
+
+    delete[] input;
+    delete[] table;
+
+    return sorted;
+}
+
+// RUN SORT TESTS -------------------------------------------------------------
+
+template< class Calc >
+bool const runSortTest( std::string const & name,
+                        int_type const elementCount,
+                        int_type const loopCount )
+{
+    float_type runTime = 0.0l;
+
+    std::cout << "sort test using fract:\n";
+    std::cout << "    - " << name << "\n";
+
+    if( sortTest< Calc >( elementCount, loopCount, runTime ) )
+    {
+        std::cout << "run time = " << runTime << " seconds\n\n\n";
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runSortTests( int_type elementCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( elementCount < 1 )
+    {
+        elementCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    bool passed = true;
+
+    passed &= runSortTest< fract::UnsafeFractCalculator >
+        ( "UnsafeFractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest
+    <
+        fract::PackedFractCalculator< fract::UnsafeFractCalculator >
+    >
+    ( "PackedFractCalculator< UnsafeFractCalculator >",
+      elementCount, loopCount );
+
+    passed &= runSortTest< fract::Unsafe32FractCalculator >
+        ( "Unsafe32FractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest< fract::Int64FractCalculator >
+        ( "Int64FractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest< fract::SafeFractCalculator >
+        ( "SafeFractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest< fract::CheckedSafeFractCalculator >
+        ( "CheckedSafeFractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest< fract::BigFractCalculator >
+        ( "BigFractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest< fract::PromotingFractCalculator >
+        ( "PromotingFractCalculator", elementCount, loopCount );
+
+#if defined( __SIZEOF_INT128__ )
+
+    passed &= runSortTest< fract::Int128FractCalculator >
+        ( "Int128FractCalculator", elementCount, loopCount );
+
+    passed &= runSortTest
+    <
+        fract::PackedFractCalculator< fract::Int128FractCalculator >
+    >
+    ( "PackedFractCalculator< Int128FractCalculator >",
+      elementCount, loopCount );
+
+#endif
+
+    return passed;
+}
+
+// ARRAY TEST -----------------------------------------------------------------
+
+template< class Calc >
+bool const arrayTest( int_type const elementCount,
+                      int_type const loopCount,
+                      int_type const mask,
+                      float_type & arrayTime,
+                      float_type & columnTime )
+{
+    typedef fract::fract< Calc > fract_type;
+    typedef fract::fract_array< Calc > array_type;
+
+    // Check inputs
+
+    if( elementCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    arrayTime = 0.0l;
+    columnTime = 0.0l;
+
+    // Construct operands as both an array of fractions and columns, using
+    // a deterministic xorshift generator so runs are comparable
+
+    std::size_t const count = ( std::size_t )elementCount;
+
+    fract_type * lhs = new fract_type[ count ];
+    fract_type * rhs = new fract_type[ count ];
+    fract_type * table = new fract_type[ count ];
+
+    array_type lColumn( count );
+    array_type rColumn( count );
+    array_type column;
+
+    int_type state = 0x9e3779b97f4a7c15u;
+
+    for( std::size_t i = 0; i < count; i += 1 )
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        lhs[ i ] = fract_type( state & mask,
+                               ( ( state >> 32 ) & mask ) | 1u,
+                               ( state & 0x100u ) != 0 );
+
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        rhs[ i ] = fract_type( state & mask,
+                               ( ( state >> 32 ) & mask ) | 1u,
+                               ( state & 0x100u ) != 0 );
+
+        lColumn.set( i, lhs[ i ] );
+        rColumn.set( i, rhs[ i ] );
+    }
+
+    // Perform test of multiply-add over an array of fractions
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        for( std::size_t j = 0; j < count; j += 1 )
+        {
+            table[ j ] = lhs[ j ] * rhs[ j ] + rhs[ j ];
+        }
+    }
+
+    float_type endTime = seconds();
+
+    arrayTime = endTime - startTime;
+
+    // Perform test of multiply-add over columns
+
+    startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        array_type::mul( lColumn, rColumn, column );
+        array_type::add( column, rColumn, column );
+    }
+
+    endTime = seconds();
+
+    columnTime = endTime - startTime;
+
+    // Check results agree
+
+    bool passed = true;
+
+    for( std::size_t i = 0; i < count; i += 1 )
+    {
+        passed &= column.get( i ) == table[ i ];
+    }
+
+    // Clean up tables
+
+    delete[] lhs;
+    delete[] rhs;
+    delete[] table;
+
+    return passed;
+}
+
+// RUN ARRAY TESTS ------------------------------------------------------------
+
+template< class Calc >
+bool const runArrayTest( std::string const & name,
+                         int_type const elementCount,
+                         int_type const loopCount,
+                         int_type const mask )
+{
+    float_type arrayTime = 0.0l;
+    float_type columnTime = 0.0l;
+
+    std::cout << "multiply-add test using fract:\n";
+    std::cout << "    - " << name << "\n";
+
+    if( arrayTest< Calc >( elementCount, loopCount, mask,
+                           arrayTime, columnTime ) )
+    {
+        std::cout << "fract array run time = " << arrayTime << " seconds\n";
+        std::cout << "fract_array run time = " << columnTime;
+        std::cout << " seconds\n\n\n";
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runArrayTests( int_type elementCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( elementCount < 1 )
+    {
+        elementCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    bool passed = true;
+
+    // Components small enough that no result overflows
+
+    passed &= runArrayTest< fract::Unsafe32FractCalculator >
+        ( "Unsafe32FractCalculator", elementCount, loopCount, 0xfffu );
+
+    passed &= runArrayTest< fract::Int64FractCalculator >
+        ( "Int64FractCalculator", elementCount, loopCount, 0xfffu );
+
+    passed &= runArrayTest< fract::CheckedSafeFractCalculator >
+        ( "CheckedSafeFractCalculator", elementCount, loopCount, 0xfffffu );
+
+#if defined( __SIZEOF_INT128__ )
+
+    passed &= runArrayTest< fract::Int128FractCalculator >
+        ( "Int128FractCalculator", elementCount, loopCount, 0xfffffu );
+
+#endif
+
+    return passed;
+}
+
+// GCD TEST -------------------------------------------------------------------
+
+template< class Engine >
+bool const gcdTest( int_type const * lhs,
+                    int_type const * rhs,
+                    int_type const operandCount,
+                    int_type const loopCount,
+                    float_type & runTime,
+                    int_type & sum )
+{
+    // Check inputs
+
+    if( operandCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    runTime = 0.0l;
+    sum = 0;
+
+    // Perform test
+
+    float_type startTime = seconds();
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        for( int_type j = 0; j < operandCount; j += 1 )
+        {
+            sum += Engine::gcd( lhs[ j ], rhs[ j ] );
+        }
+    }
+
+    float_type endTime = seconds();
+
+    // Output timing
+
+    runTime = endTime - startTime;
+
+    return true;
+}
+
+// RUN GCD TESTS --------------------------------------------------------------
+
+bool const runGcdTests( int_type operandCount, int_type loopCount )
+{
+    typedef fract::EuclideanGcd< int_type > euclid_type;
+    typedef fract::BinaryGcd< int_type > binary_type;
+
+    // Check inputs
+
+    if( operandCount < 1 )
+    {
+        operandCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    // Operand sets: small, mixed small and large, and near 64-bit
+
+    std::string const names[ 3 ] = { "small", "mixed", "near 64-bit" };
+
+    int_type const masks[ 3 ][ 2 ] =
+    {
+        { 0xffffu, 0xffffu },
+        { 0xffffu, std::numeric_limits< int_type >::max() },
+        { std::numeric_limits< int_type >::max(),
+          std::numeric_limits< int_type >::max() }
+    };
+
+    int_type * lhs = new int_type[ ( unsigned int )operandCount ];
+    int_type * rhs = new int_type[ ( unsigned int )operandCount ];
+
+    // Deterministic xorshift generator so runs are comparable
+
+    int_type state = 0x9e3779b97f4a7c15u;
+
+    float_type euclidTime = 0.0l;
+    float_type binaryTime = 0.0l;
+    int_type euclidSum = 0;
+    int_type binarySum = 0;
+    bool passed = true;
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    for( unsigned set = 0; set < 3; set += 1 )
+    {
+        // Fill operand tables
+
+        for( int_type i = 0; i < operandCount; i += 1 )
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            lhs[ i ] = ( state & masks[ set ][ 0 ] ) | 1u;
+
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            rhs[ i ] = ( state & masks[ set ][ 1 ] ) | 2u;
+
+            if( set == 2 )
+            {
+                lhs[ i ] |= ( int_type )1 << 63;
+                rhs[ i ] |= ( int_type )1 << 63;
+            }
+        }
+
+        // Time both engines over the same operands
+
+        gcdTest< euclid_type >( lhs, rhs, operandCount, loopCount,
+                                euclidTime, euclidSum );
+
+        gcdTest< binary_type >( lhs, rhs, operandCount, loopCount,
+                                binaryTime, binarySum );
+
+        std::cout << "gcd test using " << names[ set ] << " operands:\n";
+        std::cout << "euclidean run time = " << euclidTime << " seconds\n";
+        std::cout << "binary run time    = " << binaryTime << " seconds\n";
+
+        if( euclidSum != binarySum )
+        {
+            std::cout << "FAILED - results differ\n";
+            passed = false;
+        }
+
+        std::cout << "\n\n";
+    }
+
+    // Clean up tables
+
+    delete[] lhs;
+    delete[] rhs;
+
+    return passed;
+}
+
+// SIMPLIFY TEST --------------------------------------------------------------
+
+template< class Calc >
+bool const simplifyTest( int_type const elementCount,
+                         int_type const loopCount,
+                         float_type & scalarTime,
+                         float_type & batchTime,
+                         float_type & columnTime )
+{
+    typedef fract::fract< Calc > fract_type;
+    typedef fract::fract_array< Calc > array_type;
+    typedef typename fract_type::int_type component_type;
+
+    // Check inputs
+
+    if( elementCount < 1 || loopCount < 1 )
+    {
+        return false;
+    }
+
+    scalarTime = 0.0l;
+    batchTime = 0.0l;
+    columnTime = 0.0l;
+
+    // Construct unreduced fractions sharing a random factor, using a
+    // deterministic xorshift generator so runs are comparable
+
+    std::size_t const count = ( std::size_t )elementCount;
+    component_type const mask = std::numeric_limits< component_type >::max();
+    unsigned const half = std::numeric_limits< component_type >::digits / 2;
+
+    fract_type * input = new fract_type[ count ];
+    fract_type * scalar = new fract_type[ count ];
+    fract_type * batch = new fract_type[ count ];
+
+    array_type column( count );
+
+    int_type state = 0x9e3779b97f4a7c15u;
+
+    for( std::size_t i = 0; i < count; i += 1 )
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        component_type const factor = component_type( state >> 48 ) | 1u;
+        component_type const numer = component_type( state ) & ( mask >> half );
+        component_type const denom =
+            ( component_type( state >> half ) & ( mask >> half ) ) | 1u;
+
+        input[ i ].setNumerator( numer * factor );
+        input[ i ].setDenominator( denom * factor );
+        if( ( state & 0x100u ) != 0 )
+        {
+            input[ i ].makeNegative();
+        }
+    }
+
+    // Perform test of one reduction at a time
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        std::copy( input, input + count, scalar );
+
+        float_type startTime = seconds();
+
+        for( std::size_t j = 0; j < count; j += 1 )
+        {
+            scalar[ j ] = fract_type( scalar[ j ].getNumerator(),
+                                      scalar[ j ].getDenominator(),
+                                      scalar[ j ].isPositive() );
+        }
+
+        scalarTime += seconds() - startTime;
+    }
+
+    // Perform test of batch reduction over the array of fractions
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        std::copy( input, input + count, batch );
+
+        float_type startTime = seconds();
+
+        fract::simplify( batch, batch + count );
+
+        batchTime += seconds() - startTime;
+    }
+
+    // Perform test of batch reduction over columns
+
+    for( int_type i = 0; i < loopCount; i += 1 )
+    {
+        std::copy( input, input + count, batch );
+
+        for( std::size_t j = 0; j < count; j += 1 )
+        {
+            column.getNumerators()[ j ] = batch[ j ].getNumerator();
+            column.getDenominators()[ j ] = batch[ j ].getDenominator();
+            column.getSigns()[ j ] = batch[ j ].isPositive() ? 1 : 0;
+        }
+
+        float_type startTime = seconds();
+
+        column.simplify();
+
+        columnTime += seconds() - startTime;
+    }
+
+    // Check results agree
+
+    fract::simplify( batch, batch + count );
+
+    bool passed = true;
+
+    for( std::size_t i = 0; i < count; i += 1 )
+    {
+        passed &= scalar[ i ] == batch[ i ] && column.get( i ) == batch[ i ];
+    }
+
+    // Clean up tables
+
+    delete[] input;
+    delete[] scalar;
+    delete[] batch;
+
+    return passed;
+}
+
+// RUN SIMPLIFY TESTS ---------------------------------------------------------
+
+template< class Calc >
+bool const runSimplifyTest( std::string const & name,
+                            int_type const elementCount,
+                            int_type const loopCount )
+{
+    typedef typename fract::fract< Calc >::int_type component_type;
+
+    float_type scalarTime = 0.0l;
+    float_type batchTime = 0.0l;
+    float_type columnTime = 0.0l;
+
+    std::cout << "simplify test using fract:\n";
+    std::cout << "    - " << name << " ( ";
+    std::cout << fract::BatchGcd< component_type >::kernelName() << " )\n";
+
+    if( simplifyTest< Calc >( elementCount, loopCount,
+                              scalarTime, batchTime, columnTime ) )
+    {
+        std::cout << "scalar run time      = " << scalarTime << " seconds\n";
+        std::cout << "batch run time       = " << batchTime << " seconds\n";
+        std::cout << "fract_array run time = " << columnTime;
+        std::cout << " seconds\n\n\n";
+        return true;
+    }
+
+    std::cout << "FAILED\n\n\n";
+    return false;
+}
+
+bool const runSimplifyTests( int_type elementCount, int_type loopCount )
+{
+    // Check inputs
+
+    if( elementCount < 1 )
+    {
+        elementCount = 1;
+    }
+
+    if( loopCount < 1 )
+    {
+        loopCount = 1;
+    }
+
+    std::cout << std::setprecision( 16 ) << std::fixed;
+
+    bool passed = true;
+
+    passed &= runSimplifyTest< fract::UnsafeFractCalculator >
+        ( "UnsafeFractCalculator", elementCount, loopCount );
+
+    passed &= runSimplifyTest< fract::Unsafe32FractCalculator >
+        ( "Unsafe32FractCalculator", elementCount, loopCount );
+
+    return passed;
+}
+
 // TEST MATRIX ----------------------------------------------------------------
 
 bool const testMatrix( void )
@@ -505,6 +2357,17 @@ int main()
     // Run tests
 
     runSineTests( 8, 100 );
+    runToleranceTests( 8, 100 );
+    runBackendTests( 8, 100 );
+    runRotationTests( 8, 100 );
+    runHarmonicTests( 30, 1000 );
+    runPowerTests( 1000, 10 );
+    runBatchTests( 10000, 10 );
+    runStreamTests( 10000, 10 );
+    runSortTests( 10000, 10 );
+    runArrayTests( 10000, 100 );
+    runGcdTests( 1000, 100 );
+    runSimplifyTests( 10000, 100 );
     testMatrix();
     
     // Wait to exit
@@ -269,11 +269,14 @@ template <class T> matrix<T>& matrix<T>::rotate (T r)
 {
   is_initialised = true;
 
-  contents[0][0] = r.cos (); 
-  contents[0][1] = -r.sin (); 
+  T sine, cosine;
+  sincos (r, sine, cosine);
+
+  contents[0][0] = cosine; 
+  contents[0][1] = -sine; 
   contents[0][2] = (T)(0);
-  contents[1][0] = r.sin ();
-  contents[1][1] =  r.cos ();
+  contents[1][0] = sine;
+  contents[1][1] = cosine;
   contents[1][2] = (T)(0);
   contents[2][0] = (T)(0);
   contents[2][1] =  (T)(0);
@@ -16,6 +16,7 @@
 #include "NegateSymbol.h"
 #include "ObjectTraits.h"
 #include "CosineSymbol.h"
+#include "SinCosSymbol.h"
 #include "ValueSymbol.h"
 #include "SineSymbol.h"
 #include "Symbol.h"
@@ -56,6 +57,16 @@ namespace fract
         return x.cos();
     }
 
+    // SINE AND COSINE --------------------------------------------------------
+
+    template< class FractType, class Allocator >
+    void sincos( sfract< FractType, Allocator > const & x,
+                 sfract< FractType, Allocator > & sine,
+                 sfract< FractType, Allocator > & cosine )
+    {
+        x.sincos( sine, cosine );
+    }
+
     // TANGENT ----------------------------------------------------------------
 
     template< class FractType, class Allocator >
@@ -113,6 +124,7 @@ namespace fract
         typedef SineSymbol< fract_type, allocator_type > sin_symbol_type;
         typedef CosineSymbol< fract_type, allocator_type > cos_symbol_type;
         typedef TangentSymbol< fract_type, allocator_type > tan_symbol_type;
+        typedef SinCosSymbol< fract_type, allocator_type > sincos_symbol_type;
         
         // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // PUBLIC METHODS +++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -324,6 +336,38 @@ namespace fract
             return sfract( *cosSymbol );
         }
 
+        // SINE AND COSINE ----------------------------------------------------
+
+        /*  Sets [sine] and [cosine] to symbols sharing a single evaluation,
+         *  see [SinCosSymbol].
+         */
+
+        void sincos( sfract & sine, sfract & cosine ) const
+        {
+            // Clone root
+
+            symbol_type * rootClone = root->clone();
+
+            // Create sine symbol on the clone
+
+            sincos_symbol_type * sinSymbol = symbol_type::template
+                allocate< sincos_symbol_type >( allocator );
+
+            sinSymbol = new( sinSymbol ) sincos_symbol_type( *( rootClone ) );
+
+            // Create cosine symbol sharing its result
+
+            sincos_symbol_type * cosSymbol = symbol_type::template
+                allocate< sincos_symbol_type >( allocator );
+
+            cosSymbol = new( cosSymbol ) sincos_symbol_type( *sinSymbol, true );
+
+            // Assign new sfracts with the symbols as roots
+
+            sine = sfract( *sinSymbol );
+            cosine = sfract( *cosSymbol );
+        }
+
         // TANGENT ------------------------------------------------------------
 
         sfract const tan( void ) const
@@ -0,0 +1,82 @@
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDE ORDER TEST +++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/*  Includes [fract.h] ahead of the calculators, so that [fract::fract] is
+ *  declared before any header that names something else in the namespace.
+ *  Qualified names such as fract::addOverflows then refer to the class
+ *  template and fail to compile, so this file building is most of the
+ *  test. Build from the repository root with:
+ *
+ *  g++ -std=c++14 -I. tests/include_order_test.cpp
+ */
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "fract.h"
+
+#include <iostream>
+
+#include "UnsafeFractCalculator.h"
+#include "CheckedSafeFractCalculator.h"
+#include "SaturatingFractCalculator.h"
+#include "SafeFractCalculator.h"
+#include "NanFractCalculator.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// FUNCTIONS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// ARITHMETIC TEST ------------------------------------------------------------
+
+/*  Instantiates each operation, which is where the overflow helpers are
+ *  named, and checks ( 1/3 + 1/6 ) * 4 / 3 == 2/3.
+ */
+
+template< class Calc >
+bool const arithmeticTest( void )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    fract_type const sum = fract_type( 1, 3, true ) + fract_type( 1, 6, true );
+    fract_type const result =
+        sum * fract_type( 4, true ) / fract_type( 3, true );
+
+    return result == fract_type( 2, 3, true );
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// MAIN +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+int main()
+{
+    typedef fract::BasicCheckedSafeFractCalculator
+    <
+        fract::DivisionOverflowCheck
+    >
+    division_checked_calculator;
+
+    bool passed = true;
+
+    passed &= arithmeticTest< fract::UnsafeFractCalculator >();
+    passed &= arithmeticTest< fract::SafeFractCalculator >();
+    passed &= arithmeticTest< fract::CheckedSafeFractCalculator >();
+    passed &= arithmeticTest< division_checked_calculator >();
+
+#if defined( __SIZEOF_INT128__ )
+
+    passed &= arithmeticTest< fract::SaturatingFractCalculator >();
+    passed &= arithmeticTest< fract::NanFractCalculator >();
+
+#endif
+
+    std::cout << "include order test\n";
+    std::cout << ( passed ? "PASSED" : "FAILED" ) << "\n";
+
+    return passed ? 0 : 1;
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
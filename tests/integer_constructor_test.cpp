@@ -0,0 +1,81 @@
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INTEGER CONSTRUCTOR TEST +++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/*  Checks that a fraction can be built from a bare integer of any builtin
+ *  type alongside the float, double and long double constructors, and
+ *  that the value is stored exactly. Build from the repository root with:
+ *
+ *  g++ -std=c++14 -I. tests/integer_constructor_test.cpp
+ */
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include <cstdint>
+#include <limits>
+
+#include "CheckedSafeFractCalculator.h"
+#include "UnsafeFractCalculator.h"
+#include "BigFractCalculator.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// FUNCTIONS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// INTEGER TEST ---------------------------------------------------------------
+
+template< class Calc >
+bool const integerTest( void )
+{
+    typedef fract::fract< Calc > fract_type;
+
+    int const someInt = -7;
+    long long const smallest = std::numeric_limits< long long >::min();
+
+    fract_type const three( 3 );
+    fract_type const negative( someInt );
+    fract_type const assigned = 5u;
+    fract_type const lowest( smallest );
+
+    bool passed = true;
+
+    passed &= three == fract_type( 3, true );
+    passed &= negative == fract_type( 7, false );
+    passed &= assigned == fract_type( 5, true );
+    passed &= lowest.getNumerator() == 9223372036854775808u &&
+              lowest.getDenominator() == 1 && lowest.isNegative();
+    passed &= fract_type( 0 ).isZero() && fract_type( 0 ).isPositive();
+
+    return passed;
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// MAIN +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+int main()
+{
+    // Integer constants are reduced at compile time
+
+    constexpr fract::fract< fract::UnsafeFractCalculator > constant( -3 );
+
+    static_assert( constant.getNumerator() == 3 && !constant.isPositive(),
+                   "integer constructor is not constexpr" );
+
+    bool passed = true;
+
+    passed &= integerTest< fract::UnsafeFractCalculator >();
+    passed &= integerTest< fract::CheckedSafeFractCalculator >();
+    passed &= integerTest< fract::BigFractCalculator >();
+
+    std::cout << "integer constructor test\n";
+    std::cout << ( passed ? "PASSED" : "FAILED" ) << "\n";
+
+    return passed ? 0 : 1;
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
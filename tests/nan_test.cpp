@@ -0,0 +1,168 @@
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// NAN TEST +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/*  Checks that an invalid fraction of [NanFractCalculator] stays invalid
+ *  through arithmetic, [fract_array]'s kernels, the trig functions and
+ *  [limitDenominator], rather than dividing by its zero denominator or
+ *  becoming a valid zero. Build from the repository root with:
+ *
+ *  g++ -std=c++14 -I. tests/nan_test.cpp
+ */
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// INCLUDES +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include <cstdint>
+#include <vector>
+
+#include "NanFractCalculator.h"
+#include "fract_array.h"
+#include "CordicTrig.h"
+#include "fract.h"
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// FUNCTIONS ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#if defined( __SIZEOF_INT128__ )
+
+// ARRAY TEST -----------------------------------------------------------------
+
+/*  Checks that every element of [result] but the last is invalid, and that
+ *  the last equals [expected].
+ */
+
+template< class Array >
+bool const arrayTest( Array const & result,
+                      typename Array::value_type const & expected )
+{
+    typedef typename Array::CalcType calculator_type;
+
+    bool passed = result.get( result.size() - 1 ) == expected;
+
+    for( std::size_t i = 0; i + 1 < result.size(); i += 1 )
+    {
+        passed &= calculator_type::isInvalid( result.get( i ) );
+    }
+
+    return passed;
+}
+
+#endif
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// MAIN +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+int main()
+{
+    bool passed = true;
+
+#if defined( __SIZEOF_INT128__ )
+
+    typedef fract::NanFractCalculator calculator_type;
+    typedef fract::fract< calculator_type > fract_type;
+
+    fract_type const big( UINT64_MAX, 1, true );
+    fract_type const invalid = big * big;
+    fract_type const half( 1, 2, true );
+    fract_type const tolerance( 1, 1000000, true );
+
+    passed &= calculator_type::isInvalid( invalid );
+
+    // Arithmetic
+
+    passed &= calculator_type::isInvalid( invalid + half );
+    passed &= calculator_type::isInvalid( half - invalid );
+    passed &= calculator_type::isInvalid( invalid * half );
+    passed &= calculator_type::isInvalid( half / invalid );
+    passed &= calculator_type::isInvalid( invalid.reciprocal() );
+
+    // Arrays, whose last elements are valid
+
+    typedef fract::fract_array< calculator_type > array_type;
+
+    array_type lhs( 4 );
+    array_type rhs( 4 );
+    array_type result;
+
+    lhs.set( 0, invalid );
+    lhs.set( 1, half );
+    lhs.set( 2, invalid );
+    lhs.set( 3, half );
+    rhs.set( 0, half );
+    rhs.set( 1, invalid );
+    rhs.set( 2, invalid );
+    rhs.set( 3, half );
+
+    array_type::add( lhs, rhs, result );
+    passed &= arrayTest( result, fract_type( 1, true ) );
+    array_type::sub( lhs, rhs, result );
+    passed &= arrayTest( result, fract_type( 0, true ) );
+    array_type::mul( lhs, rhs, result );
+    passed &= arrayTest( result, fract_type( 1, 4, true ) );
+    array_type::div( lhs, rhs, result );
+    passed &= arrayTest( result, fract_type( 1, true ) );
+
+    std::vector< int > order;
+
+    array_type::compare( lhs, rhs, order );
+
+    for( std::size_t i = 0; i < 3; i += 1 )
+    {
+        passed &= order[ i ] == array_type::unordered;
+    }
+
+    passed &= order[ 3 ] == 0;
+
+    // Trig
+
+    fract_type sine;
+    fract_type cosine;
+
+    fract::sincos( invalid, sine, cosine );
+
+    passed &= calculator_type::isInvalid( sine );
+    passed &= calculator_type::isInvalid( cosine );
+    passed &= calculator_type::isInvalid( fract::sin( invalid ) );
+    passed &= calculator_type::isInvalid( fract::cos( invalid ) );
+    passed &= calculator_type::isInvalid( fract::tan( invalid ) );
+    passed &= calculator_type::isInvalid( fract::sin( invalid, tolerance ) );
+    passed &= calculator_type::isInvalid( fract::cos( invalid, tolerance ) );
+    passed &= calculator_type::isInvalid( fract::tan( invalid, tolerance ) );
+
+    fract::CordicTrig::sincos( invalid, sine, cosine );
+
+    passed &= calculator_type::isInvalid( sine );
+    passed &= calculator_type::isInvalid( cosine );
+    passed &= calculator_type::isInvalid( fract::CordicTrig::sin( invalid ) );
+    passed &= calculator_type::isInvalid( fract::CordicTrig::cos( invalid ) );
+    passed &= calculator_type::isInvalid( fract::CordicTrig::tan( invalid ) );
+
+    unsigned quadrant = 0;
+
+    passed &= calculator_type::isInvalid(
+        fract::reduceAngle( invalid, quadrant ) );
+
+    // Limit denominator
+
+    passed &= calculator_type::isInvalid(
+        fract::limitDenominator( invalid, 1000u ) );
+
+    // Valid values are unaffected
+
+    passed &= fract::reduceAngle( half, quadrant ) == half;
+    passed &= fract::limitDenominator( half, 1000u ) == half;
+
+#endif
+
+    std::cout << "nan test\n";
+    std::cout << ( passed ? "PASSED" : "FAILED" ) << "\n";
+
+    return passed ? 0 : 1;
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++